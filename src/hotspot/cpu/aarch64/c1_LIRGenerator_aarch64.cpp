@@ -1357,7 +1357,7 @@ void LIRGenerator::do_If(If* x) {
 
   __ cmp(lir_cond(cond), left, right);
   // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
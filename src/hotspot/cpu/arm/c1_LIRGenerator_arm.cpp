@@ -1206,10 +1206,9 @@ void LIRGenerator::do_soft_float_compare(If* x) {
   }
   // Call float compare function, returns (1,0) if true or false.
   LIR_Opr result = call_runtime(x->x(), x->y(), runtime_func, intType, nullptr);
-  __ cmp(lir_cond_equal, result,
-         compare_to_zero ?
-           LIR_OprFact::intConst(0) : LIR_OprFact::intConst(1));
-  profile_branch(x, cond);
+  LIR_Opr expected = compare_to_zero ? LIR_OprFact::intConst(0) : LIR_OprFact::intConst(1);
+  __ cmp(lir_cond_equal, result, expected);
+  profile_branch(x, cond, result, expected);
   move_to_phi(x->state());
   __ branch(lir_cond_equal, x->tsux());
 }
@@ -1266,7 +1265,7 @@ void LIRGenerator::do_If(If* x) {
   }
 
   __ cmp(lir_cond(cond), left, right);
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
@@ -3318,6 +3318,151 @@ void C2_MacroAssembler::string_indexof(Register str1, Register str2,
 
 } // string_indexof
 
+// Substring search for long substrings. A position is only a candidate
+// if both the first and the last element of the substring match there;
+// 32 (LL) or 16 (UU) positions are filtered at once with AVX2 compares,
+// and the inner elements of each candidate are then compared one by one.
+// Unlike pcmpestri, the cost per position does not grow with the length
+// of the substring.
+void C2_MacroAssembler::string_indexof_avx2(Register str1, Register str2,
+                                            Register cnt1, Register cnt2, Register result,
+                                            Register tmp1, Register tmp2, Register tmp3, Register tmp4,
+                                            XMMRegister vec1, XMMRegister vec2,
+                                            XMMRegister vec3, XMMRegister vec4, int ae) {
+  assert(UseAVX >= 2, "AVX2 intrinsics are required");
+  assert(ae == StrIntrinsicNode::LL || ae == StrIntrinsicNode::UU, "Invalid encoding");
+  //
+  // Note, inline_string_indexOf() generates checks:
+  // if (substr.count > string.count) return -1;
+  // if (substr.count == 0) return 0;
+  //
+  const bool is_bytes = (ae == StrIntrinsicNode::LL);
+  const int stride = is_bytes ? 32 : 16; // elements per 256-bit vector
+  const int elem_size = is_bytes ? 1 : 2;
+  Address::ScaleFactor scale = is_bytes ? Address::times_1 : Address::times_2;
+
+  Label VECTOR_LOOP, NEXT_VECTOR, CANDIDATE, TAIL_LOOP, TAIL_NEXT, FOUND, NOT_FOUND, DONE;
+
+  auto load_elem = [&](Register dst, Address src) {
+    if (is_bytes) {
+      movzbl(dst, src);
+    } else {
+      movzwl(dst, src);
+    }
+  };
+
+  // Compare the inner elements 1 .. cnt2-2 of the substring with the string
+  // at address tmp2. Jumps to FOUND on a match, falls through otherwise.
+  // Kills tmp1, tmp3 and tmp4.
+  auto verify_candidate = [&]() {
+    Label CMP_LOOP, MISMATCH;
+    movl(tmp3, 1);
+    bind(CMP_LOOP);
+    leal(tmp1, Address(tmp3, 1));
+    cmpl(tmp1, cnt2);
+    jcc(Assembler::greaterEqual, FOUND);
+    load_elem(tmp1, Address(str2, tmp3, scale));
+    load_elem(tmp4, Address(tmp2, tmp3, scale));
+    cmpl(tmp1, tmp4);
+    jcc(Assembler::notEqual, MISMATCH);
+    incrementl(tmp3);
+    jmp(CMP_LOOP);
+    bind(MISMATCH);
+  };
+
+  movl(cnt2, cnt2); // Zero-extend, cnt2 is used as an index below
+  // Broadcast the first and the last element of the substring.
+  if (is_bytes) {
+    vpbroadcastb(vec1, Address(str2, 0), Assembler::AVX_256bit);
+    vpbroadcastb(vec2, Address(str2, cnt2, scale, -elem_size), Assembler::AVX_256bit);
+  } else {
+    vpbroadcastw(vec1, Address(str2, 0), Assembler::AVX_256bit);
+    vpbroadcastw(vec2, Address(str2, cnt2, scale, -elem_size), Assembler::AVX_256bit);
+  }
+  // tmp4 points to the element of the string matched against the last element
+  // of the substring at position 0.
+  lea(tmp4, Address(str1, cnt2, scale, -elem_size));
+  subl(cnt1, cnt2);         // cnt1 = last candidate position
+  xorl(result, result);     // result = current position
+
+  bind(VECTOR_LOOP);
+  // Need stride candidate positions, so that no load goes past the string.
+  movl(tmp1, cnt1);
+  subl(tmp1, result);
+  cmpl(tmp1, stride - 1);
+  jcc(Assembler::less, TAIL_LOOP);
+  vmovdqu(vec3, Address(str1, result, scale));
+  vmovdqu(vec4, Address(tmp4, result, scale));
+  if (is_bytes) {
+    vpcmpeqb(vec3, vec3, vec1, Assembler::AVX_256bit);
+    vpcmpeqb(vec4, vec4, vec2, Assembler::AVX_256bit);
+  } else {
+    vpcmpeqw(vec3, vec3, vec1, Assembler::AVX_256bit);
+    vpcmpeqw(vec4, vec4, vec2, Assembler::AVX_256bit);
+  }
+  vpand(vec3, vec3, vec4, Assembler::AVX_256bit);
+  vpmovmskb(tmp1, vec3, Assembler::AVX_256bit);
+  testl(tmp1, tmp1);
+  jcc(Assembler::notZero, CANDIDATE);
+  bind(NEXT_VECTOR);
+  addl(result, stride);
+  jmp(VECTOR_LOOP);
+
+  bind(CANDIDATE);
+  // tmp1 has one bit per matching byte, relative to result.
+  bsfl(tmp2, tmp1);
+  if (!is_bytes) {
+    shrl(tmp2, 1);
+  }
+  addl(tmp2, result);
+  lea(tmp2, Address(str1, tmp2, scale));
+  movdl(vec3, tmp1);        // Save the candidate bits
+  verify_candidate();
+  movdl(tmp1, vec3);
+  // Clear the lowest candidate (two bits for chars).
+  leal(tmp4, Address(tmp1, -1));
+  andl(tmp1, tmp4);
+  if (!is_bytes) {
+    leal(tmp4, Address(tmp1, -1));
+    andl(tmp1, tmp4);
+  }
+  lea(tmp4, Address(str1, cnt2, scale, -elem_size)); // Does not modify flags
+  jcc(Assembler::notZero, CANDIDATE);
+  jmp(NEXT_VECTOR);
+
+  // Less than stride candidate positions left: check them one at a time.
+  bind(TAIL_LOOP);
+  cmpl(result, cnt1);
+  jcc(Assembler::greater, NOT_FOUND);
+  lea(tmp2, Address(str1, result, scale));
+  load_elem(tmp1, Address(tmp2, 0));
+  load_elem(tmp3, Address(str2, 0));
+  cmpl(tmp1, tmp3);
+  jcc(Assembler::notEqual, TAIL_NEXT);
+  load_elem(tmp1, Address(tmp2, cnt2, scale, -elem_size));
+  load_elem(tmp3, Address(str2, cnt2, scale, -elem_size));
+  cmpl(tmp1, tmp3);
+  jcc(Assembler::notEqual, TAIL_NEXT);
+  verify_candidate();
+  bind(TAIL_NEXT);
+  incrementl(result);
+  jmp(TAIL_LOOP);
+
+  bind(FOUND);
+  // Convert the address of the match back to an index.
+  movptr(result, tmp2);
+  subptr(result, str1);
+  if (!is_bytes) {
+    shrl(result, 1);
+  }
+  jmp(DONE);
+
+  bind(NOT_FOUND);
+  movl(result, -1);
+
+  bind(DONE);
+}
+
 void C2_MacroAssembler::string_indexof_char(Register str1, Register cnt1, Register ch, Register result,
                                             XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp) {
   ShortBranchVerifier sbv(this);
@@ -272,6 +272,14 @@
                       XMMRegister vec, Register tmp,
                       int ae);
 
+  // IndexOf for long substrings, filtering candidate positions on the first
+  // and the last substring element with AVX2 compares.
+  void string_indexof_avx2(Register str1, Register str2,
+                           Register cnt1, Register cnt2, Register result,
+                           Register tmp1, Register tmp2, Register tmp3, Register tmp4,
+                           XMMRegister vec1, XMMRegister vec2,
+                           XMMRegister vec3, XMMRegister vec4, int ae);
+
     // Smallest code: we don't need to load through stack,
     // check string tail.
 
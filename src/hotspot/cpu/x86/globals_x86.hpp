@@ -215,6 +215,10 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
   product(bool, UseLibmIntrinsic, true, DIAGNOSTIC,                         \
           "Use Libm Intrinsics")                                            \
                                                                             \
+  product(bool, UseAVX2StringIndexOf, true, DIAGNOSTIC,                     \
+          "Use the AVX2 first and last element filter for String.indexOf "  \
+          "with Latin1 or UTF16 substrings of at least 16 bytes")           \
+                                                                            \
   /* Autodetected, see vm_version_x86.cpp */                                \
   product(bool, EnableX86ECoreOpts, false, DIAGNOSTIC,                      \
           "Perform Ecore Optimization")                                     \
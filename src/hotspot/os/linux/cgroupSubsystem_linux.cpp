@@ -556,6 +556,15 @@ jlong CgroupSubsystem::memory_limit_in_bytes() {
   return mem_limit;
 }
 
+jlong CgroupSubsystem::cached_memory_usage_in_bytes() {
+  if (!_memory_usage_cache.should_check_metric()) {
+    return _memory_usage_cache.value();
+  }
+  jlong mem_usage = memory_usage_in_bytes();
+  _memory_usage_cache.set_value(mem_usage, OSCONTAINER_CACHE_TIMEOUT);
+  return mem_usage;
+}
+
 jlong CgroupSubsystem::limit_from_str(char* limit_str) {
   if (limit_str == nullptr) {
     return OSCONTAINER_ERROR;
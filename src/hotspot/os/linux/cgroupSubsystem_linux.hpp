@@ -252,8 +252,15 @@ class CachingCgroupController : public CHeapObj<mtInternal> {
 };
 
 class CgroupSubsystem: public CHeapObj<mtInternal> {
+  private:
+    CachedMetric _memory_usage_cache;
+
   public:
     jlong memory_limit_in_bytes();
+    // Like memory_usage_in_bytes(), but re-read at most once per
+    // OSCONTAINER_CACHE_TIMEOUT; for frequent queries such as
+    // os::available_memory().
+    jlong cached_memory_usage_in_bytes();
     int active_processor_count();
     jlong limit_from_str(char* limit_str);
 
@@ -43,6 +43,11 @@
   product(bool, UseLinuxPosixThreadCPUClocks, true,                     \
           "enable fast Linux Posix clocks where available")             \
                                                                         \
+  product(bool, UseFutexParker, false, EXPERIMENTAL,                    \
+          "Implement LockSupport.park/unpark and the VM's internal "    \
+          "park events directly on futexes instead of pthread mutexes " \
+          "and condition variables")                                    \
+                                                                        \
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
@@ -94,6 +99,12 @@
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
           "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
                                                                         \
+  product(bool, UseMadvCollapse, false, EXPERIMENTAL,                   \
+          "After pre-touching memory with transparent huge pages, use " \
+          "MADV_COLLAPSE to synchronously collapse ranges that were "   \
+          "populated with small pages instead of waiting for "          \
+          "khugepaged.")                                                \
+                                                                        \
 
 // end of RUNTIME_OS_FLAGS
 
@@ -92,6 +92,11 @@ jlong OSContainer::memory_usage_in_bytes() {
   return cgroup_subsystem->memory_usage_in_bytes();
 }
 
+jlong OSContainer::cached_memory_usage_in_bytes() {
+  assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
+  return cgroup_subsystem->cached_memory_usage_in_bytes();
+}
+
 jlong OSContainer::memory_max_usage_in_bytes() {
   assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
   return cgroup_subsystem->memory_max_usage_in_bytes();
@@ -232,7 +232,7 @@ julong os::Linux::available_memory_in_container() {
   if (OSContainer::is_containerized()) {
     jlong mem_limit = OSContainer::memory_limit_in_bytes();
     jlong mem_usage;
-    if (mem_limit > 0 && (mem_usage = OSContainer::memory_usage_in_bytes()) < 1) {
+    if (mem_limit > 0 && (mem_usage = OSContainer::cached_memory_usage_in_bytes()) < 1) {
       log_debug(os, container)("container memory usage failed: " JLONG_FORMAT ", using host value", mem_usage);
     }
     if (mem_limit > 0 && mem_usage > 0) {
@@ -2982,6 +2982,15 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   static_assert(MADV_POPULATE_WRITE == MADV_POPULATE_WRITE_value);
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#define MADV_COLLAPSE_value 25
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE MADV_COLLAPSE_value
+#else
+  // Sanity-check our assumed default value if we build with a new enough libc.
+  static_assert(MADV_COLLAPSE == MADV_COLLAPSE_value);
+#endif
+
 // Note that the value for MAP_FIXED_NOREPLACE differs between architectures, but all architectures
 // supported by OpenJDK share the same flag value.
 #define MAP_FIXED_NOREPLACE_value 0x100000
@@ -3060,6 +3069,13 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
       log_info(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
                        "error='%s' (errno=%d)", p2i(first), len,
                        MADV_POPULATE_WRITE, os::strerror(err), err);
+    } else if (UseMadvCollapse && ::madvise(first, len, MADV_COLLAPSE) == -1) {
+      // Best effort: huge pages may be unavailable (EAGAIN, ENOMEM) or the
+      // range may contain nothing that can be collapsed (EINVAL).
+      err = errno;
+      log_debug(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
+                        "error='%s' (errno=%d)", p2i(first), len,
+                        MADV_COLLAPSE, os::strerror(err), err);
     }
     return 0;
   }
@@ -4756,6 +4772,13 @@ jint os::init_2(void) {
     Linux::numa_init();
   }
 
+  // Check the availability of MADV_COLLAPSE (Linux 6.1). This has to be done
+  // after argument parsing, since UseMadvCollapse is only ever set explicitly.
+  if (UseMadvCollapse && ::madvise(0, 0, MADV_COLLAPSE) != 0) {
+    warning("MADV_COLLAPSE is not supported by the kernel, disabling UseMadvCollapse");
+    FLAG_SET_ERGO(UseMadvCollapse, false);
+  }
+
   if (MaxFDLimit) {
     // set the number of file descriptors to max. print out error
     // if getrlimit/setrlimit fails but continue regardless.
@@ -87,6 +87,15 @@
   #include <crt_externs.h>
 #endif
 
+#ifdef LINUX
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  // 32-bit RISC-V has no SYS_futex syscall.
+  #if defined(RISCV32) && !defined(SYS_futex) && defined(SYS_futex_time64)
+    #define SYS_futex SYS_futex_time64
+  #endif
+#endif
+
 #define ROOT_UID 0
 
 #ifndef MAP_ANONYMOUS
@@ -1494,6 +1503,70 @@ struct tm* os::localtime_pd(const time_t* clock, struct tm*  res) {
 //    Having three states allows for some detection of bad usage - see
 //    comments on unpark().
 
+#ifdef LINUX
+// Futex based variants of PlatformEvent and Parker, selected with
+// UseFutexParker. The owner waits directly on the event or permit word, so
+// neither park() nor unpark() has to take the pthread mutex, and unpark()
+// only enters the kernel when the owner may be blocked. A store to the word
+// that arrives between the owner's check and its sleep is caught by the
+// kernel's own comparison in FUTEX_WAIT.
+
+// Waits while *addr == expected, until the relative timeout ts (measured
+// against CLOCK_MONOTONIC) expires, or forever if ts is null.
+static int futex_wait(volatile int* addr, int expected, const struct timespec* ts) {
+  return syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, ts, nullptr, 0);
+}
+
+// Waits while *addr == expected, until the absolute time abst, measured
+// against CLOCK_REALTIME or CLOCK_MONOTONIC.
+static int futex_wait_until(volatile int* addr, int expected, const struct timespec* abst, bool realtime) {
+  const int op = FUTEX_WAIT_BITSET_PRIVATE | (realtime ? FUTEX_CLOCK_REALTIME : 0);
+  return syscall(SYS_futex, addr, op, expected, abst, nullptr, FUTEX_BITSET_MATCH_ANY);
+}
+
+static void futex_wake(volatile int* addr) {
+  syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+static void futex_timeout(struct timespec* ts, jlong nanos) {
+  ts->tv_sec = MIN2(nanos / NANOUNITS, (jlong)MAX_SECS);
+  ts->tv_nsec = nanos % NANOUNITS;
+}
+
+// _event is -1 exactly while the owner is (about to get) blocked, so the
+// futex wait compares against that value and unpark() only has to wake
+// after it has seen -1.
+int PlatformEvent::futex_park(jlong nanos) {
+  struct timespec abst;
+  if (nanos > 0) {
+    struct timespec rel;
+    futex_timeout(&rel, nanos);
+    clock_gettime(CLOCK_MONOTONIC, &abst);
+    abst.tv_sec += rel.tv_sec;
+    abst.tv_nsec += rel.tv_nsec;
+    if (abst.tv_nsec >= NANOUNITS) {
+      abst.tv_sec++;
+      abst.tv_nsec -= NANOUNITS;
+    }
+  }
+
+  while (Atomic::load_acquire(&_event) < 0) {
+    // Spurious wakeups and signals are ignored; the deadline is absolute.
+    if (futex_wait_until(&_event, -1, nanos > 0 ? &abst : nullptr, false) != 0 &&
+        errno == ETIMEDOUT) {
+      break;
+    }
+  }
+  const int ret = (Atomic::load(&_event) >= 0) ? OS_OK : OS_TIMEOUT;
+
+  Atomic::release_store(&_event, 0);
+  // Paranoia to ensure our lock-free paths interact correctly with each
+  // other.
+  OrderAccess::fence();
+  return ret;
+}
+#endif // LINUX
+
 PlatformEvent::PlatformEvent() {
   int status = pthread_cond_init(_cond, _condAttr);
   assert_status(status == 0, status, "cond_init");
@@ -1522,6 +1595,14 @@ void PlatformEvent::park() {       // AKA "down()"
   }
   guarantee(v >= 0, "invariant");
 
+#ifdef LINUX
+  if (v == 0 && UseFutexParker) {
+    futex_park(0);
+    guarantee(_event >= 0, "invariant");
+    return;
+  }
+#endif
+
   if (v == 0) { // Do this the hard way by blocking ...
     int status = pthread_mutex_lock(_mutex);
     assert_status(status == 0, status, "mutex_lock");
@@ -1569,6 +1650,12 @@ int PlatformEvent::park_nanos(jlong nanos) {
   }
   guarantee(v >= 0, "invariant");
 
+#ifdef LINUX
+  if (v == 0 && UseFutexParker) {
+    return futex_park(nanos);
+  }
+#endif
+
   if (v == 0) { // Do this the hard way by blocking ...
     struct timespec abst;
     to_abstime(&abst, nanos, false, false);
@@ -1623,6 +1710,14 @@ void PlatformEvent::unpark() {
 
   if (Atomic::xchg(&_event, 1) >= 0) return;
 
+#ifdef LINUX
+  if (UseFutexParker) {
+    // The owner is blocked or about to block on the futex.
+    futex_wake(&_event);
+    return;
+  }
+#endif
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "mutex_lock");
   int anyWaiters = _nParked;
@@ -1646,7 +1741,8 @@ void PlatformEvent::unpark() {
 
 // JSR166 support
 
- PlatformParker::PlatformParker() : _counter(0), _cur_index(-1) {
+ PlatformParker::PlatformParker() : _counter(0), _cur_index(-1)
+                                   LINUX_ONLY(COMMA _futex_waiting(0)) {
   int status = pthread_cond_init(&_cond[REL_INDEX], _condAttr);
   assert_status(status == 0, status, "cond_init rel");
   status = pthread_cond_init(&_cond[ABS_INDEX], nullptr);
@@ -1664,6 +1760,45 @@ PlatformParker::~PlatformParker() {
   assert_status(status == 0, status, "mutex_destroy");
 }
 
+#ifdef LINUX
+// The permit lives in _counter. _futex_waiting and _counter form a Dekker
+// pair: the parker publishes _futex_waiting before re-reading _counter, the
+// unparker publishes _counter before reading _futex_waiting, so at least
+// one of them sees the other's store and a wakeup cannot be lost.
+void PlatformParker::futex_park(bool isAbsolute, jlong time) {
+  assert(_futex_waiting == 0, "only the owner parks");
+  Atomic::release_store_fence(&_futex_waiting, 1);
+  if (Atomic::load(&_counter) == 0) {
+    // Returns on unpark, timeout, signal or spuriously; all are fine.
+    struct timespec ts;
+    if (time == 0) {
+      futex_wait(&_counter, 0, nullptr);
+    } else if (isAbsolute) {
+      // Milliseconds since the epoch, measured against CLOCK_REALTIME.
+      ts.tv_sec = time / MILLIUNITS;
+      ts.tv_nsec = (time % MILLIUNITS) * (NANOUNITS / MILLIUNITS);
+      futex_wait_until(&_counter, 0, &ts, true);
+    } else {
+      futex_timeout(&ts, time);
+      futex_wait(&_counter, 0, &ts);
+    }
+  }
+  Atomic::release_store(&_futex_waiting, 0);
+  Atomic::release_store(&_counter, 0);
+  // Paranoia to ensure our lock-free paths interact correctly with
+  // Java-level accesses.
+  OrderAccess::fence();
+}
+
+void PlatformParker::futex_unpark() {
+  // Atomic::xchg() is a full barrier, ordering the store to _counter
+  // before the load of _futex_waiting.
+  if (Atomic::xchg(&_counter, 1) == 0 && Atomic::load(&_futex_waiting) != 0) {
+    futex_wake(&_counter);
+  }
+}
+#endif // LINUX
+
 // Parker::park decrements count if > 0, else does a condvar wait.  Unpark
 // sets count to 1 and signals condvar.  Only one thread ever waits
 // on the condvar. Contention seen when trying to park implies that someone
@@ -1703,6 +1838,14 @@ void Parker::park(bool isAbsolute, jlong time) {
   // the ThreadBlockInVM() CTOR and DTOR may grab Threads_lock.
   ThreadBlockInVM tbivm(jt);
 
+#ifdef LINUX
+  if (UseFutexParker) {
+    OSThreadWaitState osts(jt->osthread(), false /* not Object.wait() */);
+    futex_park(isAbsolute, time);
+    return;
+  }
+#endif
+
   // Can't access interrupt state now that we are _thread_blocked. If we've
   // been interrupted since we checked above then _counter will be > 0.
 
@@ -1749,6 +1892,12 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+#ifdef LINUX
+  if (UseFutexParker) {
+    futex_unpark();
+    return;
+  }
+#endif
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
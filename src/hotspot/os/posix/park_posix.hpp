@@ -47,6 +47,12 @@ class PlatformEvent : public CHeapObj<mtSynchronizer> {
   pthread_cond_t  _cond[1];  // Native condition variable for blocking
   double postPad[2];
 
+#ifdef LINUX
+  // Blocks on _event directly (UseFutexParker), for at most nanos if
+  // positive. Returns OS_OK or OS_TIMEOUT.
+  int futex_park(jlong nanos);
+#endif
+
  protected:       // TODO-FIXME: make dtor private
   ~PlatformEvent() { guarantee(false, "invariant"); } // immortal so can't delete
 
@@ -85,6 +91,15 @@ class PlatformParker {
   int _cur_index;  // which cond is in use: -1, 0, 1
   pthread_mutex_t _mutex[1];
   pthread_cond_t  _cond[2]; // one for relative times and one for absolute
+#ifdef LINUX
+  // Set while the owner is blocked on _counter in the futex based path
+  // (UseFutexParker), so that unpark() can skip the wake syscall when
+  // nobody is waiting.
+  volatile int _futex_waiting;
+
+  void futex_park(bool isAbsolute, jlong time);
+  void futex_unpark();
+#endif
 
  public:
   PlatformParker();
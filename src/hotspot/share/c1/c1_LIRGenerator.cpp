@@ -921,7 +921,7 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != nullptr, "method should be set if branch is profiled");
@@ -938,6 +938,51 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
       not_taken_count_offset = t;
     }
 
+    // With sampling, only every C1ProfileSampleRate-th execution in a thread,
+    // on average, updates the profile, by C1ProfileSampleRate at once. This keeps threads
+    // running the same hot method from contending on the MDO cache lines.
+    int increment = DataLayout::counter_increment;
+    LabelObj* L_skip = nullptr;
+    if (C1ProfileSampleRate > 1) {
+      increment *= C1ProfileSampleRate;
+      L_skip = new LabelObj();
+
+      LIR_Address* countdown_addr =
+        new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_countdown_offset()), T_INT);
+      LIR_Opr countdown = new_register(T_INT);
+      __ move(countdown_addr, countdown);
+      __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+      __ move(countdown, countdown_addr);
+      __ cmp(lir_cond_greater, countdown, 0);
+      __ branch(lir_cond_greater, L_skip->label());
+
+      // Pick the next countdown from [1, 2 * C1ProfileSampleRate - 1], so that
+      // it is C1ProfileSampleRate on average, but branches executed with a
+      // period related to the rate do not always fall on the same phase. The
+      // thread-local seed is advanced with a 32-bit xorshift step.
+      LIR_Address* seed_addr =
+        new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_seed_offset()), T_INT);
+      LIR_Opr seed = new_register(T_INT);
+      LIR_Opr tmp = new_register(T_INT);
+      __ move(seed_addr, seed);
+      shift_op(Bytecodes::_ishl, tmp, seed, LIR_OprFact::intConst(13), LIR_OprFact::illegalOpr);
+      logic_op(Bytecodes::_ixor, seed, seed, tmp);
+      shift_op(Bytecodes::_iushr, tmp, seed, LIR_OprFact::intConst(17), LIR_OprFact::illegalOpr);
+      logic_op(Bytecodes::_ixor, seed, seed, tmp);
+      shift_op(Bytecodes::_ishl, tmp, seed, LIR_OprFact::intConst(5), LIR_OprFact::illegalOpr);
+      logic_op(Bytecodes::_ixor, seed, seed, tmp);
+      __ move(seed, seed_addr);
+      // (seed >>> 16) * (2 * rate - 1) >>> 16 does not overflow for rates up to 1024
+      LIR_Opr next = new_register(T_INT);
+      shift_op(Bytecodes::_iushr, next, seed, LIR_OprFact::intConst(16), LIR_OprFact::illegalOpr);
+      arithmetic_op_int(Bytecodes::_imul, next, next, LIR_OprFact::intConst(2 * C1ProfileSampleRate - 1), new_register(T_INT));
+      shift_op(Bytecodes::_iushr, next, next, LIR_OprFact::intConst(16), LIR_OprFact::illegalOpr);
+      __ add(next, LIR_OprFact::intConst(1), next);
+      __ move(next, countdown_addr);
+      // recompute the condition codes of the branch
+      __ cmp(lir_cond(cond), left, right);
+    }
+
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
@@ -952,9 +997,15 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
     // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+    LIR_Address* fake_incr_value = new LIR_Address(data_reg, increment, T_INT);
     __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
     __ move(data_reg, data_addr);
+
+    if (L_skip != nullptr) {
+      // the sampling code killed the condition codes the branch depends on
+      __ branch_destination(L_skip->label());
+      __ cmp(lir_cond(cond), left, right);
+    }
   }
 }
 
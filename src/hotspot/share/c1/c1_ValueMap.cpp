@@ -267,6 +267,7 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   bool                  _too_complicated_loop;
   bool                  _has_field_store[T_VOID];
   bool                  _has_indexed_store[T_VOID];
+  GrowableArray<ciField*> _stored_fields;          // resolved fields stored to in the current loop
 
   // simplified access to methods of GlobalValueNumbering
   ValueMap* current_map()                        { return _gvn->current_map(); }
@@ -277,7 +278,12 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   void      kill_field(ciField* field, bool all_offsets)  {
     current_map()->kill_field(field, all_offsets);
     assert(field->type()->basic_type() >= 0 && field->type()->basic_type() < T_VOID, "Invalid type");
-    _has_field_store[field->type()->basic_type()] = true;
+    if (all_offsets) {
+      // the holder of an unresolved field is not reliable, kill by type
+      _has_field_store[field->type()->basic_type()] = true;
+    } else if (!_stored_fields.contains(field)) {
+      _stored_fields.append(field);
+    }
   }
   void      kill_array(ValueType* type)                   {
     current_map()->kill_array(type);
@@ -290,16 +296,34 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
     : _gvn(gvn)
     , _loop_blocks(ValueMapMaxLoopSize)
     , _too_complicated_loop(false)
+    , _stored_fields()
   {
+    clear_stores();
+  }
+
+  void clear_stores() {
     for (int i = 0; i < T_VOID; i++) {
       _has_field_store[i] = false;
       _has_indexed_store[i] = false;
     }
+    _stored_fields.clear();
   }
 
-  bool has_field_store(BasicType type) {
+  // A store aliases a load if it writes the same field of the same holder;
+  // unresolved stores alias every field of their type.
+  bool has_field_store(ciField* field) {
+    BasicType type = field->type()->basic_type();
     assert(type < T_VOID, "Invalid type");
-    return _has_field_store[type];
+    if (_has_field_store[type]) {
+      return true;
+    }
+    for (int i = 0; i < _stored_fields.length(); i++) {
+      ciField* stored = _stored_fields.at(i);
+      if (stored->holder() == field->holder() && stored->offset_in_bytes() == field->offset_in_bytes()) {
+        return true;
+      }
+    }
+    return false;
   }
 
   bool has_indexed_store(BasicType type) {
@@ -406,7 +430,7 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
     } else if (cur->as_LoadField() != nullptr) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
-      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()->type()->basic_type()) && is_invariant(lf->obj()) && _insert_is_pred;
+      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()) && is_invariant(lf->obj()) && _insert_is_pred;
     } else if (cur->as_ArrayLength() != nullptr) {
       ArrayLength *length = cur->as_ArrayLength();
       cur_invariant = is_invariant(length->array());
@@ -465,6 +489,7 @@ bool ShortLoopOptimizer::process(BlockBegin* loop_header) {
 
   _too_complicated_loop = false;
   _loop_blocks.clear();
+  clear_stores();
   _loop_blocks.append(loop_header);
 
   for (int i = 0; i < _loop_blocks.length(); i++) {
@@ -308,6 +308,13 @@
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
+  product(int, C1ProfileSampleRate, 1, EXPERIMENTAL,                        \
+          "Update branch profiles in Tier 3 C1 generated code only on "     \
+          "every n-th execution per thread on average, at random "          \
+          "intervals, scaling the counts by n. "                            \
+          "1 updates on every execution")                                   \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, C1OptimizeVirtualCallProfiling, true,                       \
           "Use CHA and exact type results at call sites when updating MDOs")\
                                                                             \
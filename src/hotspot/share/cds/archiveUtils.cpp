@@ -40,6 +40,9 @@
 #include "memory/resourceArea.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/nonJavaThread.hpp"
+#include "runtime/os.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -352,3 +355,83 @@ void ArchiveUtils::log_to_classlist(BootstrapInfo* bootstrap_specifier, TRAPS) {
     }
   }
 }
+
+void ArchiveWorkerTask::configure_max_chunks(int max_chunks) {
+  assert(max_chunks > 0, "sanity");
+  _max_chunks = max_chunks;
+  _chunk = 0;
+}
+
+void ArchiveWorkerTask::run() {
+  while (true) {
+    int chunk = Atomic::fetch_then_add(&_chunk, 1);
+    if (chunk >= _max_chunks) {
+      return;
+    }
+    work(chunk, _max_chunks);
+  }
+}
+
+class ArchiveWorkerThread : public NamedThread {
+  ArchiveWorkers* _pool;
+
+public:
+  ArchiveWorkerThread(ArchiveWorkers* pool, int id) : NamedThread(), _pool(pool) {
+    set_name("ArchiveWorkerThread#%d", id);
+  }
+
+  void run() override {
+    _pool->_task->run();
+    // The pool may be gone as soon as we have signaled it.
+    _pool->worker_done();
+  }
+
+  void post_run() override {
+    NamedThread::post_run();
+    delete this;
+  }
+
+  const char* type_name() const override { return "ArchiveWorkerThread"; }
+};
+
+ArchiveWorkers::ArchiveWorkers() : _end_semaphore(0), _num_workers(0), _task(nullptr) {
+  if (ArchiveParallelRelocation) {
+    _num_workers = MIN2(os::initial_active_processor_count(), MAX_WORKERS) - 1;
+  }
+}
+
+bool ArchiveWorkers::start_worker(int id) {
+  ArchiveWorkerThread* t = new ArchiveWorkerThread(this, id);
+  if (!os::create_thread(t, os::os_thread)) {
+    delete t;
+    return false;
+  }
+  os::start_thread(t);
+  return true;
+}
+
+void ArchiveWorkers::run_task(ArchiveWorkerTask* task) {
+  assert(_task == nullptr, "only one task per pool");
+  _task = task;
+
+  int started = 0;
+  if (_num_workers > 0) {
+    task->configure_max_chunks((_num_workers + 1) * CHUNKS_PER_WORKER);
+    for (int i = 0; i < _num_workers; i++) {
+      if (!start_worker(i)) {
+        break;
+      }
+      started++;
+    }
+  } else {
+    task->configure_max_chunks(1);
+  }
+  log_debug(cds)("Running task %s with %d helper threads", task->name(), started);
+
+  // Help out, then wait for the helpers to finish their last chunks.
+  task->run();
+  for (int i = 0; i < started; i++) {
+    _end_semaphore.wait();
+  }
+  _task = nullptr;
+}
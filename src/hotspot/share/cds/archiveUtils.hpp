@@ -28,6 +28,7 @@
 #include "cds/serializeClosure.hpp"
 #include "logging/log.hpp"
 #include "memory/virtualspace.hpp"
+#include "runtime/semaphore.hpp"
 #include "utilities/bitMap.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
@@ -127,6 +128,45 @@ class SharedDataRelocator: public BitMapClosure {
   bool do_bit(size_t offset);
 };
 
+// A unit of work that can be split into chunks and executed by ArchiveWorkers.
+// Chunks are claimed dynamically, so work() may be called any number of times
+// on any thread, but each chunk is processed exactly once.
+class ArchiveWorkerTask : public StackObj {
+  const char* _name;
+  int _max_chunks;
+  volatile int _chunk;
+
+public:
+  ArchiveWorkerTask(const char* name) : _name(name), _max_chunks(0), _chunk(0) {}
+  const char* name() const { return _name; }
+
+  void configure_max_chunks(int max_chunks);
+  void run();
+
+  virtual void work(int chunk, int max_chunks) = 0;
+};
+
+// Short-lived helper threads used while the archive is being mapped, which
+// happens too early in VM startup to use the GC worker threads. The calling
+// thread always participates, and the helpers exit when the task is done.
+class ArchiveWorkers : public StackObj {
+  friend class ArchiveWorkerThread;
+
+  static const int CHUNKS_PER_WORKER = 4;
+  static const int MAX_WORKERS = 8;
+
+  Semaphore _end_semaphore;
+  int _num_workers;
+  ArchiveWorkerTask* _task;
+
+  bool start_worker(int id);
+  void worker_done() { _end_semaphore.signal(); }
+
+public:
+  ArchiveWorkers();
+  void run_task(ArchiveWorkerTask* task);
+};
+
 class DumpRegion {
 private:
   const char* _name;
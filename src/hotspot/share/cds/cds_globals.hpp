@@ -94,6 +94,10 @@
            "(2) always map at preferred address, and if unsuccessful, "     \
            "do not map the archive")                                        \
            range(0, 2)                                                      \
+                                                                            \
+  product(bool, ArchiveParallelRelocation, true, DIAGNOSTIC,                \
+          "Use helper threads to relocate pointers in large archives "      \
+          "that are not mapped at the requested address")                   \
 // end of CDS_FLAGS
 
 DECLARE_FLAGS(CDS_FLAGS)
@@ -1895,6 +1895,28 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Patches the pointers marked in one slice of the relocation bitmap.
+class SharedDataRelocationTask : public ArchiveWorkerTask {
+  const BitMapView* _ptrmap;
+  SharedDataRelocator* _patcher;
+
+public:
+  // Below this size (8MB of archived pointer slots) the serial loop is fast enough.
+  static const size_t MIN_PARALLEL_BITS = 1 * M;
+
+  SharedDataRelocationTask(const BitMapView* ptrmap, SharedDataRelocator* patcher) :
+    ArchiveWorkerTask("Shared Data Relocation"), _ptrmap(ptrmap), _patcher(patcher) {}
+
+  void work(int chunk, int max_chunks) override {
+    BitMap::idx_t size = _ptrmap->size();
+    BitMap::idx_t beg = MIN2(size, align_down(size / max_chunks * chunk, BitsPerWord));
+    BitMap::idx_t end = (chunk == max_chunks - 1) ? size :
+                        MIN2(size, align_down(size / max_chunks * (chunk + 1), BitsPerWord));
+    // SharedDataRelocator has no mutable state, so it can be shared by all workers.
+    _ptrmap->iterate(_patcher, beg, end);
+  }
+};
+
 // This is called when we cannot map the archive at the requested[ base address (usually 0x800000000).
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
@@ -1927,7 +1949,14 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    if (ptrmap_size_in_bits >= SharedDataRelocationTask::MIN_PARALLEL_BITS) {
+      // Large archives: starting a few helper threads pays off.
+      ArchiveWorkers workers;
+      SharedDataRelocationTask task(&ptrmap, &patcher);
+      workers.run_task(&task);
+    } else {
+      ptrmap.iterate(&patcher);
+    }
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
@@ -1999,7 +2028,7 @@ void FileMapInfo::map_or_load_heap_region() {
         // TODO - remove implicit knowledge of G1
         log_info(cds)("Cannot use CDS heap data. UseG1GC is required for -XX:-UseCompressedOops");
       } else {
-        log_info(cds)("Cannot use CDS heap data. UseEpsilonGC, UseG1GC, UseSerialGC or UseParallelGC are required.");
+        log_info(cds)("Cannot use CDS heap data. UseEpsilonGC, UseG1GC, UseSerialGC, UseParallelGC or UseShenandoahGC are required.");
       }
     }
   }
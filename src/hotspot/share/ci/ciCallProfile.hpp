@@ -39,14 +39,17 @@ class ciCallProfile : StackObj {
   friend class ciMethodHandle;
 
   enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  enum { ReceiverLimit = 8 }; // Max receivers recorded (max TypeProfileWidth)
   int  _limit;                // number of receivers have been determined
+  int  _receivers;            // number of receivers recorded, >= _limit
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[ReceiverLimit + 1]; // # times receivers have been seen
+  ciKlass*  _receiver[ReceiverLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
     _limit = 0;
+    _receivers = 0;
     _morphism    = 0;
     _count = -1;
     _receiver_count[0] = -1;
@@ -60,17 +63,20 @@ class ciCallProfile : StackObj {
   bool      has_receiver(int i) const { return _limit > i; }
   int       morphism() const          { return _morphism; }
 
+  // All recorded receivers, beyond MorphismLimit, for polymorphic call sites.
+  int       receivers() const         { return _receivers; }
+
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _receivers, "out of Call Profile ReceiverLimit");
     return _receiver_count[i];
   }
   float     receiver_prob(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _receivers, "out of Call Profile ReceiverLimit");
     return (float)_receiver_count[i]/(float)_count;
   }
   ciKlass*  receiver(int i)        {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _receivers, "out of Call Profile ReceiverLimit");
     return _receiver[i];
   }
 };
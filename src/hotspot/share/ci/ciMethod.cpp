@@ -541,14 +541,15 @@ void ciCallProfile::add_receiver(ciKlass* receiver, int receiver_count) {
   // for it otherwise replace the less called receiver (less called receiver
   // is placed to the last array element which is not used).
   // First array's element contains most called receiver.
-  int i = _limit;
+  int i = _receivers;
   for (; i > 0 && receiver_count > _receiver_count[i-1]; i--) {
     _receiver[i] = _receiver[i-1];
     _receiver_count[i] = _receiver_count[i-1];
   }
   _receiver[i] = receiver;
   _receiver_count[i] = receiver_count;
-  if (_limit < MorphismLimit) _limit++;
+  if (_receivers < ReceiverLimit) _receivers++;
+  _limit = MIN2(_receivers, (int)MorphismLimit);
 }
 
 
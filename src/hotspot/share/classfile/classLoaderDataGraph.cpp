@@ -32,14 +32,18 @@
 #include "classfile/packageEntry.hpp"
 #include "code/dependencyContext.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcCause.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/vmOperations.hpp"
@@ -128,6 +132,7 @@ ClassLoaderData* volatile ClassLoaderDataGraph::_head = nullptr;
 
 bool ClassLoaderDataGraph::_should_clean_deallocate_lists = false;
 bool ClassLoaderDataGraph::_safepoint_cleanup_needed = false;
+ClassLoaderData* ClassLoaderDataGraph::_deferred_purge_head = nullptr;
 bool ClassLoaderDataGraph::_metaspace_oom = false;
 
 // Add a new class loader data node to the list.  Assign the newly created
@@ -463,11 +468,38 @@ void ClassLoaderDataGraph::clean_module_and_package_info() {
   }
 }
 
-void ClassLoaderDataGraph::purge(bool at_safepoint) {
-  ClassUnloadingContext::context()->purge_class_loader_data();
+// Deleting thousands of unlinked CLDs can take a good part of a pause. The
+// CLDs are unreachable once unlinked, so STW collectors may leave the deletion
+// to the ServiceThread. This is not done for metadata-triggered GCs, whose
+// callers retry the failed allocation right after and need the space now.
+static bool should_defer_purge(bool at_safepoint) {
+  if (!DeferClassLoaderDataPurge || !at_safepoint) {
+    return false;
+  }
+  GCCause::Cause cause = Universe::heap()->gc_cause();
+  return cause != GCCause::_metadata_GC_threshold &&
+         cause != GCCause::_metadata_GC_clear_soft_refs;
+}
 
+void ClassLoaderDataGraph::purge(bool at_safepoint) {
   bool classes_unloaded = ClassUnloadingContext::context()->has_unloaded_classes();
 
+  if (classes_unloaded && should_defer_purge(at_safepoint)) {
+    ClassLoaderData* head = ClassUnloadingContext::context()->release_class_loader_data();
+    ClassLoaderData* tail = head;
+    while (tail->unloading_next() != nullptr) {
+      tail = tail->unloading_next();
+    }
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    tail->set_unloading_next(_deferred_purge_head);
+    _deferred_purge_head = head;
+    Service_lock->notify_all();
+    // Nothing has been freed yet; the chunks are purged after the deletion.
+    classes_unloaded = false;
+  } else {
+    ClassUnloadingContext::context()->purge_class_loader_data();
+  }
+
   Metaspace::purge(classes_unloaded);
   if (classes_unloaded) {
     set_metaspace_oom(false);
@@ -491,6 +523,48 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
   }
 }
 
+bool ClassLoaderDataGraph::has_deferred_purge_work() {
+  assert_lock_strong(Service_lock);
+  return _deferred_purge_head != nullptr;
+}
+
+void ClassLoaderDataGraph::purge_deferred() {
+  // Delete a bounded number of CLDs per call, so that the ServiceThread
+  // does not hold off safepoints for long. The rest is picked up on the
+  // next ServiceThread iteration.
+  const int max_per_step = 64;
+  ClassLoaderData* head;
+  {
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    head = _deferred_purge_head;
+    ClassLoaderData* last = head;
+    for (int i = 1; last != nullptr && i < max_per_step; i++) {
+      last = last->unloading_next();
+    }
+    if (last != nullptr) {
+      _deferred_purge_head = last->unloading_next();
+      last->set_unloading_next(nullptr);
+    } else {
+      _deferred_purge_head = nullptr;
+    }
+  }
+
+  int deleted = 0;
+  for (ClassLoaderData* cld = head; cld != nullptr;) {
+    assert(cld->is_unloading(), "invariant");
+    ClassLoaderData* next = cld->unloading_next();
+    delete cld;
+    cld = next;
+    deleted++;
+  }
+
+  Metaspace::purge(deleted > 0);
+  if (deleted > 0) {
+    set_metaspace_oom(false);
+  }
+  log_debug(class, loader, data)("Purged %d deferred class loader data", deleted);
+}
+
 ClassLoaderDataGraphKlassIteratorAtomic::ClassLoaderDataGraphKlassIteratorAtomic()
     : _next_klass(nullptr) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
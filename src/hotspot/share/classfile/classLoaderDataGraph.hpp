@@ -49,6 +49,10 @@ class ClassLoaderDataGraph : public AllStatic {
   static bool _should_clean_deallocate_lists;
   static bool _safepoint_cleanup_needed;
 
+  // Unlinked CLDs whose deletion has been handed to the ServiceThread,
+  // linked through unloading_next(). See DeferClassLoaderDataPurge.
+  static ClassLoaderData* _deferred_purge_head;
+
   // OOM has been seen in metaspace allocation. Used to prevent some
   // allocations until class unloading
   static bool _metaspace_oom;
@@ -63,6 +67,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
   static void clean_module_and_package_info();
   static void purge(bool at_safepoint);
+  // Called from ServiceThread
+  static bool has_deferred_purge_work();
+  static void purge_deferred();
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   static void verify_claimed_marks_cleared(int claim);
@@ -40,6 +40,7 @@
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -55,6 +56,9 @@ const size_t REHASH_LEN = 100;
 
 Dictionary::Dictionary(ClassLoaderData* loader_data, size_t table_size)
   : _number_of_entries(0), _loader_data(loader_data) {
+  for (int i = 0; i < LOOKUP_CACHE_SIZE; i++) {
+    _lookup_cache[i] = nullptr;
+  }
 
   size_t start_size_log_2 = MAX2(ceil_log2(table_size), (size_t)2); // 2 is minimum size even though some dictionaries only have one entry
   size_t current_size = ((size_t)1) << start_size_log_2;
@@ -279,6 +283,12 @@ void Dictionary::add_klass(JavaThread* current, Symbol* class_name,
 // The entry may be accessed by the VM thread in verification.
 DictionaryEntry* Dictionary::get_entry(Thread* current,
                                        Symbol* class_name) {
+  const int cache_index = class_name->identity_hash() & (LOOKUP_CACHE_SIZE - 1);
+  DictionaryEntry* cached = Atomic::load_acquire(&_lookup_cache[cache_index]);
+  if (cached != nullptr && cached->instance_klass()->name() == class_name) {
+    return cached;
+  }
+
   DictionaryLookup lookup(class_name);
   DictionaryEntry* result = nullptr;
   auto get = [&] (DictionaryEntry** value) {
@@ -288,6 +298,9 @@ DictionaryEntry* Dictionary::get_entry(Thread* current,
   bool needs_rehashing = false;
   _table->get(current, lookup, get, &needs_rehashing);
   assert (!needs_rehashing, "should never need rehashing");
+  if (result != nullptr) {
+    Atomic::release_store(&_lookup_cache[cache_index], result);
+  }
   return result;
 }
 
@@ -57,6 +57,14 @@ class Dictionary : public CHeapObj<mtClass> {
   ClassLoaderData* _loader_data;  // backpointer to owning loader
   ClassLoaderData* loader_data() const { return _loader_data; }
 
+  // A small direct-mapped cache of recently found entries, indexed by the
+  // identity hash of the class name. It saves the hash table walk for
+  // repeated lookups of the same classes, e.g. from Class.forName loops.
+  // Entries are never removed from a Dictionary while it is alive, so
+  // cached entries cannot go stale and need no invalidation.
+  static const int LOOKUP_CACHE_SIZE = 16;
+  DictionaryEntry* volatile _lookup_cache[LOOKUP_CACHE_SIZE];
+
   DictionaryEntry* get_entry(Thread* current, Symbol* name);
   bool check_if_needs_resize();
   int table_size() const;
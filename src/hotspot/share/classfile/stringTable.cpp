@@ -528,7 +528,17 @@ void StringTable::do_concurrent_work(JavaThread* jt) {
   log_debug(stringtable, perf)("Concurrent work, live factor: %g", get_load_factor());
   // We prefer growing, since that also removes dead items
   if (should_grow()) {
+    size_t old_size = _current_size;
     grow(jt);
+    if (_current_size > old_size && should_grow()) {
+      // A single doubling was not enough. Take the next step on another
+      // ServiceThread pass rather than waiting for the next GC notification,
+      // so other service work can run in between.
+      log_debug(stringtable)("Still above preferred load factor, continuing growth");
+      Atomic::release_store(&_has_work, false);
+      trigger_concurrent_work();
+      return;
+    }
   } else {
     clean_dead_entries(jt);
   }
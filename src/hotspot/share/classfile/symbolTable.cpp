@@ -482,29 +482,44 @@ void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHa
   // Note that is_permanent will be false for non-strong hidden classes.
   // even if their loader is the boot loader because they will have a different cld.
   bool is_permanent = loader_data->is_the_null_class_loader_data();
+
+  // Share one scratch buffer for the temporary Symbols of the whole batch.
+  int max_len = 0;
+  for (int i = 0; i < names_count; i++) {
+    max_len = MAX2(max_len, lengths[i]);
+  }
+  Thread* current = Thread::current();
+  ResourceMark rm(current);
+  u1* buf = NEW_RESOURCE_ARRAY_IN_THREAD(current, u1, Symbol::byte_size(max_len));
+
   for (int i = 0; i < names_count; i++) {
     const char *name = names[i];
     int len = lengths[i];
     unsigned int hash = hashValues[i];
     assert(lookup_shared(name, len, hash) == nullptr, "must have checked already");
-    Symbol* sym = do_add_if_needed(name, len, hash, is_permanent);
+    Symbol* sym = do_add_if_needed(current, buf, name, len, hash, is_permanent);
     assert(sym->refcount() != 0, "lookup should have incremented the count");
     cp->symbol_at_put(cp_indices[i], sym);
   }
 }
 
 Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, bool is_permanent) {
+  Thread* current = Thread::current();
+  ResourceMark rm(current);
+  const int alloc_size = Symbol::byte_size(len);
+  u1* u1_buf = NEW_RESOURCE_ARRAY_IN_THREAD(current, u1, alloc_size);
+  return do_add_if_needed(current, u1_buf, name, len, hash, is_permanent);
+}
+
+Symbol* SymbolTable::do_add_if_needed(Thread* current, u1* buf, const char* name, int len,
+                                      uintx hash, bool is_permanent) {
   SymbolTableLookup lookup(name, len, hash);
   SymbolTableGet stg;
   bool clean_hint = false;
   bool rehash_warning = false;
-  Thread* current = Thread::current();
   Symbol* sym;
 
-  ResourceMark rm(current);
-  const int alloc_size = Symbol::byte_size(len);
-  u1* u1_buf = NEW_RESOURCE_ARRAY_IN_THREAD(current, u1, alloc_size);
-  Symbol* tmp = ::new ((void*)u1_buf) Symbol((const u1*)name, len,
+  Symbol* tmp = ::new ((void*)buf) Symbol((const u1*)name, len,
                                              (is_permanent || CDSConfig::is_dumping_static_archive()) ? PERM_REFCOUNT : 1);
 
   do {
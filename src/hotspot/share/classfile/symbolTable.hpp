@@ -76,6 +76,10 @@ class SymbolTable : public AllStatic {
 
   static Symbol* do_lookup(const char* name, int len, uintx hash);
   static Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool is_permanent);
+  // Same, but uses the caller-provided scratch buffer (at least Symbol::byte_size(len)
+  // bytes) for the temporary Symbol, so bulk callers need not allocate for each name.
+  static Symbol* do_add_if_needed(Thread* current, u1* buf, const char* name, int len,
+                                  uintx hash, bool is_permanent);
 
   // lookup only, won't add. Also calculate hash. Used by the ClassfileParser.
   static Symbol* lookup_only(const char* name, int len, unsigned int& hash);
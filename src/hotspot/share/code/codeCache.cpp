@@ -31,6 +31,7 @@
 #include "code/dependencyContext.hpp"
 #include "code/nmethod.hpp"
 #include "code/pcDesc.hpp"
+#include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
@@ -168,6 +169,7 @@ class CodeBlob_sizes {
 
 address CodeCache::_low_bound = 0;
 address CodeCache::_high_bound = 0;
+size_t CodeCache::_reserved_page_size = 0;
 volatile int CodeCache::_number_of_nmethods_with_dependencies = 0;
 ExceptionCache* volatile CodeCache::_exception_cache_purge_list = nullptr;
 
@@ -367,6 +369,14 @@ ReservedCodeSpace CodeCache::reserve_heap_memory(size_t size, size_t rs_ps) {
                                           rs_size/K));
   }
 
+  // The reservation falls back to small pages if large pages are not available
+  if (rs.page_size() < rs_ps) {
+    log_warning(codecache)("Could not reserve code cache with " PROPERFMT " pages, "
+                           "using " PROPERFMT " pages instead.",
+                           PROPERFMTARGS(rs_ps), PROPERFMTARGS(rs.page_size()));
+  }
+  _reserved_page_size = rs.page_size();
+
   // Initialize bounds
   _low_bound = (address)rs.base();
   _high_bound = _low_bound + rs.size();
@@ -1434,15 +1444,19 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+// Returns the number of nmethods made not entrant.
+int CodeCache::make_marked_nmethods_deoptimized() {
+  int count = 0;
   RelaxedNMethodIterator iter(RelaxedNMethodIterator::only_not_unloading);
   while(iter.next()) {
     nmethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
+      count++;
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1825,6 +1839,7 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
     st->print_cr(" total_blobs=" UINT32_FORMAT ", nmethods=" UINT32_FORMAT
                  ", adapters=" UINT32_FORMAT ", full_count=" UINT32_FORMAT,
                  blob_count(), nmethod_count(), adapter_count(), full_count);
+    st->print_cr(" page_size=" SIZE_FORMAT "Kb", _reserved_page_size/K);
     st->print_cr("Compilation: %s, stopped_count=%d, restarted_count=%d",
                  CompileBroker::should_compile_new_jobs() ?
                  "enabled" : Arguments::mode() == Arguments::_int ?
@@ -1850,6 +1865,58 @@ void CodeCache::print_codelist(outputStream* st) {
   }
 }
 
+struct ICMissSite {
+  nmethod* _nm;
+  CompiledIC* _ic;
+  uint _misses;
+};
+
+static int compare_ic_misses(ICMissSite* a, ICMissSite* b) {
+  return a->_misses > b->_misses ? -1 : (a->_misses < b->_misses ? 1 : 0);
+}
+
+// Print the virtual call sites with the most inline cache misses, at most
+// limit of them. Must be called at a safepoint so that the inline caches
+// can be read without the CompiledICLocker.
+void CodeCache::print_inline_cache_misses(outputStream* st, int limit) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  ResourceMark rm;
+  GrowableArray<ICMissSite> sites;
+
+  NMethodIterator iter(NMethodIterator::only_not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    RelocIterator relocs(nm);
+    while (relocs.next()) {
+      if (relocs.type() == relocInfo::virtual_call_type) {
+        CompiledIC* ic = CompiledIC_at(&relocs);
+        if (ic->data()->miss_count() > 0) {
+          ICMissSite site = { nm, ic, ic->data()->miss_count() };
+          sites.append(site);
+        }
+      }
+    }
+  }
+  sites.sort(compare_ic_misses);
+
+  for (int i = 0; i < sites.length() && i < limit; i++) {
+    ICMissSite& site = sites.at(i);
+    CompiledIC* ic = site._ic;
+    st->print("%6u %s %d ", site._misses,
+              ic->is_megamorphic() ? "megamorphic" : (ic->is_clean() ? "clean      " : "monomorphic"),
+              site._nm->compile_id());
+    PcDesc* pd = site._nm->pc_desc_at(ic->end_of_call());
+    if (pd != nullptr) {
+      ScopeDesc* sd = site._nm->scope_desc_at(ic->end_of_call());
+      sd->method()->print_short_name(st);
+      st->print_cr(" @ %d", sd->bci());
+    } else {
+      site._nm->method()->print_short_name(st);
+      st->print_cr(" @ " INTPTR_FORMAT, p2i(ic->instruction_address()));
+    }
+  }
+}
+
 void CodeCache::print_layout(outputStream* st) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   ResourceMark rm;
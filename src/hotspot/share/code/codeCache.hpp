@@ -95,6 +95,7 @@ class CodeCache : AllStatic {
 
   static address _low_bound;                                 // Lower bound of CodeHeap addresses
   static address _high_bound;                                // Upper bound of CodeHeap addresses
+  static size_t _reserved_page_size;                         // Page size the CodeHeaps were reserved with
   static volatile int _number_of_nmethods_with_dependencies; // Total number of nmethods with dependencies
 
   static uint8_t           _unloading_cycle;          // Global state for recognizing old nmethods that need to be unloaded
@@ -230,6 +231,7 @@ class CodeCache : AllStatic {
 
   // Dcmd (Diagnostic commands)
   static void print_codelist(outputStream* st);
+  static void print_inline_cache_misses(outputStream* st, int limit);
   static void print_layout(outputStream* st);
 
   // The full limits of the codeCache
@@ -237,6 +239,7 @@ class CodeCache : AllStatic {
   static address low_bound(CodeBlobType code_blob_type);
   static address high_bound()                         { return _high_bound; }
   static address high_bound(CodeBlobType code_blob_type);
+  static size_t reserved_page_size()                  { return _reserved_page_size; }
 
   // Profiling
   static size_t capacity();
@@ -294,7 +297,7 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization(DeoptimizationScope* deopt_scope);
   static void mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method* dependee);
-  static void make_marked_nmethods_deoptimized();
+  static int make_marked_nmethods_deoptimized();
 
   static void mark_directives_matches(bool top_only = false);
   static void recompile_marked_directives_matches();
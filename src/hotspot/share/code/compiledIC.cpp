@@ -72,7 +72,8 @@ CompiledICData::CompiledICData()
     _speculated_klass(),
     _itable_defc_klass(),
     _itable_refc_klass(),
-    _is_initialized() {}
+    _is_initialized(),
+    _miss_count(0) {}
 
 // Inline cache callsite info is initialized once the first time it is resolved
 void CompiledICData::initialize(CallInfo* call_info, Klass* receiver_klass) {
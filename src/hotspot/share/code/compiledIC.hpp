@@ -68,6 +68,7 @@ class CompiledICData : public CHeapObj<mtCode> {
   Klass*             _itable_defc_klass;
   Klass*             _itable_refc_klass;
   bool               _is_initialized;
+  uint               _miss_count;        // IC misses handled by the runtime for this call site
 
   bool is_speculated_klass_unloaded() const;
 
@@ -91,6 +92,10 @@ class CompiledICData : public CHeapObj<mtCode> {
 
   bool is_initialized()       const { return _is_initialized; }
 
+  // Only updated while holding the CompiledICLocker
+  uint miss_count()           const { return _miss_count; }
+  void inc_miss_count()             { _miss_count++; }
+
   // GC Support
   void clean_metadata();
   void metadata_do(MetadataClosure* cl);
@@ -55,7 +55,8 @@ ArenaStatCounter::ArenaStatCounter() :
   _current(0), _start(0), _peak(0),
   _na(0), _ra(0),
   _limit(0), _hit_limit(false),
-  _na_at_peak(0), _ra_at_peak(0), _live_nodes_at_peak(0)
+  _na_at_peak(0), _ra_at_peak(0), _live_nodes_at_peak(0),
+  _phase(nullptr), _phase_at_peak(nullptr)
 {}
 
 size_t ArenaStatCounter::peak_since_start() const {
@@ -66,6 +67,7 @@ void ArenaStatCounter::start(size_t limit) {
   _peak = _start = _current;
   _limit = limit;
   _hit_limit = false;
+  _phase = _phase_at_peak = nullptr;
 }
 
 void ArenaStatCounter::end(){
@@ -113,6 +115,7 @@ bool ArenaStatCounter::account(ssize_t delta, int tag) {
     assert(delta > 0, "Sanity (%zu %zu %zu)", _current, _start, _peak);
     _na_at_peak = _na;
     _ra_at_peak = _ra;
+    _phase_at_peak = _phase;
     update_c2_node_count();
     rc = true;
     // Did we hit the memory limit?
@@ -125,6 +128,9 @@ bool ArenaStatCounter::account(ssize_t delta, int tag) {
 
 void ArenaStatCounter::print_on(outputStream* st) const {
   st->print("%zu [na %zu ra %zu]", peak_since_start(), _na_at_peak, _ra_at_peak);
+  if (_phase_at_peak != nullptr) {
+    st->print(" (peak in %s)", _phase_at_peak);
+  }
 #ifdef ASSERT
   st->print(" (%zu->%zu->%zu)", _start, _peak, _current);
 #endif
@@ -189,6 +195,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   size_t _na_at_peak;
   size_t _ra_at_peak;
   unsigned _live_nodes_at_peak;
+  const char* _phase_at_peak;
   const char* _result;
 
 public:
@@ -197,7 +204,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     : _method(method), _comptype(compiler_c1),
       _time(0), _num_recomp(0), _thread(nullptr),
       _total(0), _na_at_peak(0), _ra_at_peak(0), _live_nodes_at_peak(0),
-      _result(nullptr) {
+      _phase_at_peak(nullptr), _result(nullptr) {
   }
 
   void set_comptype(CompilerType comptype) { _comptype = comptype; }
@@ -209,6 +216,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   void set_na_at_peak(size_t n) { _na_at_peak = n; }
   void set_ra_at_peak(size_t n) { _ra_at_peak = n; }
   void set_live_nodes_at_peak(unsigned n) { _live_nodes_at_peak = n; }
+  void set_phase_at_peak(const char* s) { _phase_at_peak = s; }
 
   void set_result(const char* s) { _result = s; }
 
@@ -221,6 +229,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     st->print_cr("  RA     : ...how much in resource areas");
     st->print_cr("  result : Result: 'ok' finished successfully, 'oom' hit memory limit, 'err' compilation failed");
     st->print_cr("  #nodes : ...how many nodes (c2 only)");
+    st->print_cr("  phase  : ...in which compiler phase (c2 only)");
     st->print_cr("  time   : time of last compilation (sec)");
     st->print_cr("  type   : compiler type");
     st->print_cr("  #rc    : how often recompiled");
@@ -228,7 +237,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   }
 
   static void print_header(outputStream* st) {
-    st->print_cr("total     NA        RA        result  #nodes  time    type  #rc thread              method");
+    st->print_cr("total     NA        RA        result  #nodes  phase           time    type  #rc thread              method");
   }
 
   void print_on(outputStream* st, bool human_readable) const {
@@ -266,6 +275,10 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     st->print("%u ", _live_nodes_at_peak);
     col += 8; st->fill_to(col);
 
+    // Compiler phase when memory peaked
+    st->print("%.15s ", _phase_at_peak != nullptr ? _phase_at_peak : "-");
+    col += 16; st->fill_to(col);
+
     // TimeStamp
     st->print("%.3f ", _time);
     col += 8; st->fill_to(col);
@@ -306,7 +319,7 @@ class MemStatTable :
 
   void add(const FullMethodName& fmn, CompilerType comptype,
            size_t total, size_t na_at_peak, size_t ra_at_peak,
-           unsigned live_nodes_at_peak, const char* result) {
+           unsigned live_nodes_at_peak, const char* phase_at_peak, const char* result) {
     assert_lock_strong(NMTCompilationCostHistory_lock);
 
     MemStatEntry** pe = get(fmn);
@@ -327,6 +340,7 @@ class MemStatTable :
     e->set_na_at_peak(na_at_peak);
     e->set_ra_at_peak(ra_at_peak);
     e->set_live_nodes_at_peak(live_nodes_at_peak);
+    e->set_phase_at_peak(phase_at_peak);
     e->set_result(result);
   }
 
@@ -418,6 +432,7 @@ void CompilationMemoryStatistic::on_end_compilation() {
                     arena_stat->na_at_peak(),
                     arena_stat->ra_at_peak(),
                     arena_stat->live_nodes_at_peak(),
+                    arena_stat->phase_at_peak(),
                     result);
   }
 
@@ -58,6 +58,9 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   size_t _ra_at_peak;
   // Number of live nodes when total peaked (c2 only)
   unsigned _live_nodes_at_peak;
+  // Current compiler phase, and the phase when total peaked (c2 only)
+  const char* _phase;
+  const char* _phase_at_peak;
 
   void update_c2_node_count();
 
@@ -71,6 +74,14 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   size_t na_at_peak() const { return _na_at_peak; }
   size_t ra_at_peak() const { return _ra_at_peak; }
   unsigned live_nodes_at_peak() const { return _live_nodes_at_peak; }
+  const char* phase_at_peak() const { return _phase_at_peak; }
+
+  // Set the current compiler phase name (a string literal); returns the previous one.
+  const char* set_phase(const char* name) {
+    const char* prev = _phase;
+    _phase = name;
+    return prev;
+  }
 
   // Mark the start and end of a compilation.
   void start(size_t limit);
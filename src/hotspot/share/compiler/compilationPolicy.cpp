@@ -874,7 +874,13 @@ bool CompilationPolicy::is_old(const methodHandle& method) {
 }
 
 double CompilationPolicy::weight(Method* method) {
-  return (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
+  double w = (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
+  if (TieredCompileTaskCostAware) {
+    // Compile time grows with the size of the method, so a small hot method
+    // pays off earlier than a big one of the same hotness.
+    w /= method->code_size() + 1;
+  }
+  return w;
 }
 
 // Apply heuristics and return true if x should be compiled before y
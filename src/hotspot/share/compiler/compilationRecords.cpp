@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "compiler/compilationRecords.hpp"
+#include "compiler/compileTask.hpp"
+#include "compiler/compiler_globals.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+CompilationRecords::Record* CompilationRecords::_records = nullptr;
+int CompilationRecords::_next  = 0;
+int CompilationRecords::_count = 0;
+
+void CompilationRecords::record(CompileTask* task, const elapsedTimer& time, jlong cpu_time) {
+  if (CompilationRecordCount == 0) {
+    return;
+  }
+  char* name;
+  {
+    ResourceMark rm;
+    name = os::strdup(task->method()->name_and_sig_as_C_string(), mtCompiler);
+  }
+
+  MutexLocker ml(CompileStatistics_lock);
+  if (_records == nullptr) {
+    _records = NEW_C_HEAP_ARRAY(Record, CompilationRecordCount, mtCompiler);
+  }
+  if (_count == (int)CompilationRecordCount) {
+    // Overwrite the oldest record
+    os::free(_records[_next]._method_name);
+  } else {
+    _count++;
+  }
+  Record* r = &_records[_next];
+  _next = (_next + 1) % CompilationRecordCount;
+
+  r->_method_name   = name;
+  r->_compile_id    = task->compile_id();
+  r->_comp_level    = task->comp_level();
+  r->_osr_bci       = task->osr_bci();
+  r->_success       = task->is_success();
+  r->_code_size     = task->method()->code_size();
+  r->_inlined_bytes = task->num_inlined_bytecodes();
+  r->_nm_size       = task->is_success() ? task->nm_total_size() : 0;
+  r->_wall_ticks    = time.ticks();
+  r->_cpu_time      = cpu_time;
+}
+
+int CompilationRecords::compare_cpu_time(int* a, int* b) {
+  const Record* ra = &_records[*a];
+  const Record* rb = &_records[*b];
+  // Fall back to wall time if the CPU time could not be measured
+  jlong ta = ra->_cpu_time >= 0 ? ra->_cpu_time : (jlong)(TimeHelper::counter_to_seconds(ra->_wall_ticks) * NANOSECS_PER_SEC);
+  jlong tb = rb->_cpu_time >= 0 ? rb->_cpu_time : (jlong)(TimeHelper::counter_to_seconds(rb->_wall_ticks) * NANOSECS_PER_SEC);
+  return ta > tb ? -1 : (ta < tb ? 1 : 0);
+}
+
+void CompilationRecords::print_on(outputStream* st, int limit) {
+  MutexLocker ml(CompileStatistics_lock);
+  if (_count == 0) {
+    st->print_cr("No compilations recorded (CompilationRecordCount=" UINTX_FORMAT ")", CompilationRecordCount);
+    return;
+  }
+
+  GrowableArray<int> order(_count);
+  for (int i = 0; i < _count; i++) {
+    order.append(i);
+  }
+  order.sort(compare_cpu_time);
+
+  st->print_cr("%d of the last %d compilations, by CPU time:", MIN2(limit, _count), _count);
+  st->print_cr("  cpu ms  wall ms     id lvl   bci  bytes inlined  nm size  method");
+  for (int i = 0; i < order.length() && i < limit; i++) {
+    const Record* r = &_records[order.at(i)];
+    if (r->_cpu_time >= 0) {
+      st->print("%8.2f ", (double)r->_cpu_time / NANOSECS_PER_MILLISEC);
+    } else {
+      st->print("%8s ", "-");
+    }
+    st->print("%8.2f %6d %3d ", TimeHelper::counter_to_millis(r->_wall_ticks), r->_compile_id, r->_comp_level);
+    if (r->_osr_bci != InvocationEntryBci) {
+      st->print("%5d ", r->_osr_bci);
+    } else {
+      st->print("%5s ", "");
+    }
+    st->print("%6d %7d ", r->_code_size, r->_inlined_bytes);
+    if (r->_success) {
+      st->print("%8d  ", r->_nm_size);
+    } else {
+      st->print("%8s  ", "failed");
+    }
+    st->print_cr("%s", r->_method_name);
+  }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_COMPILATIONRECORDS_HPP
+#define SHARE_COMPILER_COMPILATIONRECORDS_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class CompileTask;
+class elapsedTimer;
+class outputStream;
+
+// A bounded ring of records describing the most recent compilations,
+// CompilationRecordCount of them. Printed by Compiler.statistics, sorted
+// by the CPU time the compilations took.
+class CompilationRecords : AllStatic {
+  struct Record {
+    char* _method_name;      // C heap copy, the method may be unloaded later
+    int   _compile_id;
+    int   _comp_level;
+    int   _osr_bci;
+    bool  _success;
+    int   _code_size;        // bytecode size of the compiled method
+    int   _inlined_bytes;
+    int   _nm_size;          // total size of the installed nmethod
+    jlong _wall_ticks;
+    jlong _cpu_time;         // nanoseconds, -1 if unknown
+  };
+
+  static Record* _records;   // guarded by CompileStatistics_lock
+  static int     _next;
+  static int     _count;
+
+  static int compare_cpu_time(int* a, int* b);
+
+ public:
+  static void record(CompileTask* task, const elapsedTimer& time, jlong cpu_time);
+  static void print_on(outputStream* st, int limit);
+};
+
+#endif // SHARE_COMPILER_COMPILATIONRECORDS_HPP
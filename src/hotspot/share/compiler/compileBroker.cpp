@@ -33,6 +33,7 @@
 #include "compiler/compilationLog.hpp"
 #include "compiler/compilationMemoryStatistic.hpp"
 #include "compiler/compilationPolicy.hpp"
+#include "compiler/compilationRecords.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
 #include "compiler/compilerEvent.hpp"
@@ -125,6 +126,11 @@ volatile bool CompileBroker::_should_block = false;
 volatile int  CompileBroker::_print_compilation_warning = 0;
 volatile jint CompileBroker::_should_compile_new_jobs = run_compilation;
 
+volatile jlong CompileBroker::_compiler_cpu_time = 0;
+jlong CompileBroker::_cpu_budget_sample_cpu_time = 0;
+jlong CompileBroker::_cpu_budget_sample_wall_time = 0;
+bool  CompileBroker::_cpu_budget_exceeded = false;
+
 // The installed compiler(s)
 AbstractCompiler* CompileBroker::_compilers[2];
 
@@ -492,6 +498,12 @@ void CompileQueue::remove(CompileTask* task) {
   }
   --_size;
   ++_total_removed;
+
+  jlong wait = os::elapsed_counter() - task->time_queued();
+  _total_wait += wait;
+  if (wait > _peak_wait) {
+    _peak_wait = wait;
+  }
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -1020,6 +1032,27 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+// Compiler threads may use at most CompilerThreadCPUBudget percent of the
+// processors available to the VM, which includes the container quota. The
+// CPU time spent compiling is compared to the budget over windows of at
+// least 100ms of wall time.
+bool CompileBroker::is_within_cpu_budget() {
+  assert_lock_strong(CompileThread_lock);
+  if (CompilerThreadCPUBudget >= 100 || !os::is_thread_cpu_time_supported()) {
+    return true;
+  }
+  jlong now = os::javaTimeNanos();
+  jlong wall = now - _cpu_budget_sample_wall_time;
+  if (wall >= 100 * NANOSECS_PER_MILLISEC) {
+    jlong cpu = Atomic::load(&_compiler_cpu_time);
+    jlong budget = wall / 100 * CompilerThreadCPUBudget * os::active_processor_count();
+    _cpu_budget_exceeded = (cpu - _cpu_budget_sample_cpu_time) > budget;
+    _cpu_budget_sample_cpu_time = cpu;
+    _cpu_budget_sample_wall_time = now;
+  }
+  return !_cpu_budget_exceeded;
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
@@ -1030,12 +1063,29 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  if (!is_within_cpu_budget()) {
+    if (trace_compiler_threads()) {
+      ResourceMark rm;
+      stringStream msg;
+      msg.print("Not adding compiler threads: CPU budget of %u%% exceeded", CompilerThreadCPUBudget);
+      print_compiler_threads(msg);
+    }
+    CompileThread_lock->unlock();
+    return;
+  }
+  // With a CPU budget, never run more compiler threads of one type than the
+  // budget has processors.
+  int cpu_limit = max_jint;
+  if (CompilerThreadCPUBudget < 100) {
+    cpu_limit = MAX2(1, os::active_processor_count() * (int)CompilerThreadCPUBudget / 100);
+  }
+
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN2(cpu_limit, MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
-        (int)(available_cc_np / (128*K)));
+        (int)(available_cc_np / (128*K))));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1093,10 +1143,10 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN2(cpu_limit, MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
-        (int)(available_cc_p / (128*K)));
+        (int)(available_cc_p / (128*K))));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -1960,7 +2010,12 @@ void CompileBroker::compiler_thread_loop() {
       if (method()->number_of_breakpoints() == 0) {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+          bool track_cpu_time = CompilerThreadCPUBudget < 100 && os::is_thread_cpu_time_supported();
+          jlong cpu_start = track_cpu_time ? os::current_thread_cpu_time() : 0;
           invoke_compiler_on_method(task);
+          if (track_cpu_time) {
+            Atomic::add(&_compiler_cpu_time, os::current_thread_cpu_time() - cpu_start);
+          }
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
@@ -2150,6 +2205,7 @@ static void whitebox_lock_compilation() {
 void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   task->print_ul();
   elapsedTimer time;
+  jlong cpu_start = (CompilationRecordCount > 0 && os::is_thread_cpu_time_supported()) ? os::current_thread_cpu_time() : -1;
 
   DirectiveSet* directive = task->directive();
   if (directive->PrintCompilationOption) {
@@ -2360,6 +2416,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   DTRACE_METHOD_COMPILE_END_PROBE(method, compiler_name(task_level), task->is_success());
 
   collect_statistics(thread, time, task);
+  CompilationRecords::record(task, time, cpu_start >= 0 ? os::current_thread_cpu_time() - cpu_start : -1);
 
   if (PrintCompilation && PrintCompilation2) {
     tty->print("%7d ", (int) tty->time_stamp().milliseconds());  // print timestamp
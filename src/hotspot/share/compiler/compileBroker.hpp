@@ -91,6 +91,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int _peak_size;
   uint _total_added;
   uint _total_removed;
+  jlong _total_wait;   // elapsed counter ticks removed tasks spent in the queue
+  jlong _peak_wait;
 
   void purge_stale_tasks();
  public:
@@ -101,6 +103,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _size = 0;
     _total_added = 0;
     _total_removed = 0;
+    _total_wait = 0;
+    _peak_wait = 0;
     _peak_size = 0;
     _first_stale = nullptr;
   }
@@ -121,6 +125,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
+  jlong       get_total_wait()    const          { return _total_wait; }
+  jlong       get_peak_wait()     const          { return _peak_wait; }
 
   // Redefine Classes support
   void mark_on_stack();
@@ -236,6 +242,12 @@ class CompileBroker: AllStatic {
 
   static volatile int _print_compilation_warning;
 
+  // CPU time spent compiling, sampled against CompilerThreadCPUBudget
+  static volatile jlong _compiler_cpu_time;
+  static jlong _cpu_budget_sample_cpu_time;
+  static jlong _cpu_budget_sample_wall_time;
+  static bool  _cpu_budget_exceeded;
+
   enum ThreadType {
     compiler_t,
     deoptimizer_t
@@ -244,6 +256,7 @@ class CompileBroker: AllStatic {
   static JavaThread* make_thread(ThreadType type, jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, JavaThread* THREAD);
   static void init_compiler_threads();
   static void possibly_add_compiler_threads(JavaThread* THREAD);
+  static bool is_within_cpu_budget();
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
 
   static CompileTask* create_compile_task(CompileQueue*       queue,
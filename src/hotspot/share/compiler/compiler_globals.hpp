@@ -269,6 +269,16 @@
           "Maximum rate sampling interval (in milliseconds)")               \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, TieredCompileTaskCostAware, false, EXPERIMENTAL,            \
+          "Prefer queued compilations with a high benefit to cost ratio, "  \
+          "estimating the cost from the bytecode size of the method")       \
+                                                                            \
+  product(uintx, CompilationRecordCount, 256,                               \
+          "Number of recent compilations whose bytecode size, inlined "     \
+          "size, nmethod size and time are kept for Compiler.statistics. "  \
+          "0 disables the records")                                         \
+          range(0, 64*K)                                                    \
+                                                                            \
   product(ccstr, CompilationMode, "default",                                \
           "Compilation modes: "                                             \
           "default: normal tiered compilation; "                            \
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#include "gc/epsilon/epsilonHeap.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/vmOperation.hpp"
+#include "runtime/vmThread.hpp"
+
+class VM_EpsilonArena : public VM_Operation {
+public:
+  enum Action {
+    _mark,
+    _reset,
+    _unmark,
+    _print
+  };
+
+private:
+  const Action _action;
+  outputStream* const _out;
+
+public:
+  VM_EpsilonArena(Action action, outputStream* out) : _action(action), _out(out) {}
+
+  VMOp_Type type() const { return VMOp_EpsilonArena; }
+
+  void doit() {
+    EpsilonHeap* heap = EpsilonHeap::heap();
+    switch (_action) {
+      case _mark:   heap->arena_mark(_out);      break;
+      case _reset:  heap->arena_reset(_out);     break;
+      case _unmark: heap->arena_unmark(_out);    break;
+      case _print:  heap->print_arenas_on(_out); break;
+      default:      ShouldNotReachHere();
+    }
+  }
+};
+
+EpsilonArenaDCmd::EpsilonArenaDCmd(outputStream* output, bool heap) :
+  DCmdWithParser(output, heap),
+  _action("action", "mark, reset, unmark or print", "STRING", true, nullptr) {
+  _dcmdparser.add_dcmd_argument(&_action);
+}
+
+void EpsilonArenaDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseEpsilonGC || !EpsilonArenaReset) {
+    output()->print_cr("Arenas require -XX:+UseEpsilonGC -XX:+EpsilonArenaReset");
+    return;
+  }
+
+  const char* const action = _action.value();
+  VM_EpsilonArena::Action a;
+  if (strcmp(action, "mark") == 0) {
+    a = VM_EpsilonArena::_mark;
+  } else if (strcmp(action, "reset") == 0) {
+    a = VM_EpsilonArena::_reset;
+  } else if (strcmp(action, "unmark") == 0) {
+    a = VM_EpsilonArena::_unmark;
+  } else if (strcmp(action, "print") == 0) {
+    a = VM_EpsilonArena::_print;
+  } else {
+    output()->print_cr("Unknown action: %s", action);
+    return;
+  }
+
+  VM_EpsilonArena op(a, output());
+  VMThread::execute(&op);
+}
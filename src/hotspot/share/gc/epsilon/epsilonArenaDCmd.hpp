@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_EPSILON_EPSILONARENADCMD_HPP
+#define SHARE_GC_EPSILON_EPSILONARENADCMD_HPP
+
+#include "services/diagnosticArgument.hpp"
+#include "services/diagnosticFramework.hpp"
+
+// Splits the Epsilon heap into arenas and resets them, see EpsilonArenaReset.
+class EpsilonArenaDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _action;
+
+public:
+  static int num_arguments() { return 1; }
+  EpsilonArenaDCmd(outputStream* output, bool heap);
+  static const char* name() { return "GC.epsilon_arena"; }
+  static const char* description() {
+    return "Manage Epsilon heap arenas. 'mark' starts a new arena at the current "
+           "allocation point, 'reset' discards everything allocated in the innermost "
+           "arena, 'unmark' merges the innermost arena into the enclosing one, "
+           "'print' shows the arenas. Requires -XX:+EpsilonArenaReset.";
+  }
+  static const char* impact() {
+    return "Medium: 'reset' scans the heap below the innermost arena.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+#endif // SHARE_GC_EPSILON_EPSILONARENADCMD_HPP
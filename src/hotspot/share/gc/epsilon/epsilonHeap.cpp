@@ -24,20 +24,29 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/threads.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -311,6 +320,150 @@ void EpsilonHeap::print_on(outputStream *st) const {
   MetaspaceUtils::print_on(st);
 }
 
+// Finds a reference into the arena starting at the given mark.
+class EpsilonArenaRefClosure : public BasicOopIterateClosure {
+private:
+  HeapWord* const _mark;
+  void* _from;
+  oop _to;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (_to == nullptr && obj != nullptr && cast_from_oop<HeapWord*>(obj) >= _mark) {
+      _from = p;
+      _to = obj;
+    }
+  }
+
+public:
+  EpsilonArenaRefClosure(HeapWord* mark) : _mark(mark), _from(nullptr), _to(nullptr) {}
+
+  void do_oop(oop* p)       { do_oop_work(p); }
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+
+  bool found() const { return _to != nullptr; }
+  void* from()  const { return _from; }
+  oop to()      const { return _to; }
+};
+
+class EpsilonIsOutsideArenaClosure : public BoolObjectClosure {
+private:
+  HeapWord* const _mark;
+public:
+  EpsilonIsOutsideArenaClosure(HeapWord* mark) : _mark(mark) {}
+  bool do_object_b(oop obj) { return cast_from_oop<HeapWord*>(obj) < _mark; }
+};
+
+void EpsilonHeap::arena_mark(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+
+  // Retire all TLABs, so that nothing allocated from now on can be placed
+  // below the mark.
+  ensure_parsability(true /* retire_tlabs */);
+  _arena_marks.push(_space->top());
+
+  print_arenas_on(st);
+}
+
+bool EpsilonHeap::arena_unmark(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  if (_arena_marks.is_empty()) {
+    st->print_cr("No arena to unmark");
+    return false;
+  }
+
+  // The innermost arena is merged into the one enclosing it.
+  _arena_marks.pop();
+
+  print_arenas_on(st);
+  return true;
+}
+
+bool EpsilonHeap::arena_reset(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  if (_arena_marks.is_empty()) {
+    st->print_cr("No arena to reset");
+    return false;
+  }
+
+  ensure_parsability(true /* retire_tlabs */);
+  HeapWord* const mark = _arena_marks.top();
+
+  // Epsilon does not mark, so it cannot tell what in the arena is still live.
+  // Refuse the reset if anything outside the arena may still lead into it:
+  // the objects below the mark, and the strong roots.
+  EpsilonArenaRefClosure cl(mark);
+  oop holder = nullptr;
+  for (HeapWord* cur = _space->bottom(); cur < mark && !cl.found();) {
+    oop obj = cast_to_oop(cur);
+    obj->oop_iterate(&cl);
+    if (cl.found()) {
+      holder = obj;
+    }
+    cur += obj->size();
+  }
+  if (!cl.found()) {
+    CLDToOopClosure cld_cl(&cl, ClassLoaderData::_claim_none);
+    ClassLoaderDataGraph::cld_do(&cld_cl);
+  }
+  if (!cl.found()) {
+    CodeBlobToOopClosure blobs_cl(&cl, !CodeBlobToOopClosure::FixRelocations);
+    Threads::oops_do(&cl, &blobs_cl);
+  }
+  if (!cl.found()) {
+    CodeBlobToOopClosure blobs_cl(&cl, !CodeBlobToOopClosure::FixRelocations);
+    CodeCache::blobs_do(&blobs_cl);
+  }
+  if (!cl.found()) {
+    OopStorageSet::strong_oops_do(&cl);
+  }
+
+  if (cl.found()) {
+    ResourceMark rm;
+    st->print_cr("Arena not reset: " PTR_FORMAT " (%s) is still referenced from " PTR_FORMAT "%s%s",
+                 p2i(cl.to()), cl.to()->klass()->external_name(), p2i(cl.from()),
+                 holder != nullptr ? " in " : " in roots",
+                 holder != nullptr ? holder->klass()->external_name() : "");
+    return false;
+  }
+
+  // Weak references into the arena are cleared, like after a collection.
+  EpsilonIsOutsideArenaClosure is_alive(mark);
+  DoNothingClosure keep_alive;
+  WeakProcessor::weak_oops_do(&is_alive, &keep_alive);
+
+  const size_t discarded = pointer_delta(_space->top(), mark, sizeof(char));
+  _space->set_top(mark);
+
+  // Restart the occupancy steps from the new usage.
+  const size_t used = _space->used();
+  Atomic::store(&_last_counter_update, used);
+  Atomic::store(&_last_heap_print, used);
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Arena reset: discarded " SIZE_FORMAT "%s",
+               byte_size_in_proper_unit(discarded), proper_unit_for_byte_size(discarded));
+  print_arenas_on(st);
+  return true;
+}
+
+void EpsilonHeap::print_arenas_on(outputStream* st) const {
+  HeapWord* end = _space->top();
+  for (int i = _arena_marks.length() - 1; i >= 0; i--) {
+    HeapWord* const start = _arena_marks.at(i);
+    const size_t used = pointer_delta(end, start, sizeof(char));
+    st->print_cr("Arena %d: [" PTR_FORMAT ", " PTR_FORMAT "), " SIZE_FORMAT "%s used",
+                 i, p2i(start), p2i(end),
+                 byte_size_in_proper_unit(used), proper_unit_for_byte_size(used));
+    end = start;
+  }
+  const size_t used = pointer_delta(end, _space->bottom(), sizeof(char));
+  st->print_cr("Base: [" PTR_FORMAT ", " PTR_FORMAT "), " SIZE_FORMAT "%s used",
+               p2i(_space->bottom()), p2i(end),
+               byte_size_in_proper_unit(used), proper_unit_for_byte_size(used));
+}
+
 bool EpsilonHeap::print_location(outputStream* st, void* addr) const {
   return BlockLocationPrinter<EpsilonHeap>::print_location(st, addr);
 }
@@ -33,6 +33,7 @@
 #include "gc/shared/space.hpp"
 #include "memory/virtualspace.hpp"
 #include "services/memoryManager.hpp"
+#include "utilities/growableArray.hpp"
 
 class EpsilonHeap : public CollectedHeap {
   friend class VMStructs;
@@ -48,6 +49,8 @@ class EpsilonHeap : public CollectedHeap {
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  // Arena start addresses, innermost last. See EpsilonArenaReset.
+  GrowableArrayCHeap<HeapWord*, mtGC> _arena_marks;
 
 public:
   static EpsilonHeap* heap();
@@ -127,6 +130,12 @@ class EpsilonHeap : public CollectedHeap {
   MemRegion reserved_region() const { return _reserved; }
   bool is_in_reserved(const void* addr) const { return _reserved.contains(addr); }
 
+  // Arena support, see EpsilonArenaReset. Must be called at a safepoint.
+  void arena_mark(outputStream* st);
+  bool arena_reset(outputStream* st);
+  bool arena_unmark(outputStream* st);
+  void print_arenas_on(outputStream* st) const;
+
   // Support for loading objects from CDS archive into the heap
   bool can_load_archived_objects() const override { return UseCompressedOops; }
   HeapWord* allocate_loaded_archive_space(size_t size) override;
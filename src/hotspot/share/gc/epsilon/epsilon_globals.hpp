@@ -85,7 +85,14 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonArenaReset, false, EXPERIMENTAL,                     \
+          "Allow the application to split the heap into arenas with the "   \
+          "GC.epsilon_arena diagnostic command, and to reset the innermost "\
+          "arena, discarding everything allocated in it. A reset is "       \
+          "refused if the rest of the heap or the strong roots still "      \
+          "reference the arena.")
 
 // end of GC_EPSILON_FLAGS
 
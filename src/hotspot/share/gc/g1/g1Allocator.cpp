@@ -335,9 +335,10 @@ void G1PLABAllocator::PLABData::notify_plab_refill(size_t tolerated_refills, siz
   }
 }
 
-G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
+G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator, uint worker_id) :
   _g1h(G1CollectedHeap::heap()),
-  _allocator(allocator) {
+  _allocator(allocator),
+  _worker_id(worker_id) {
 
   if (ResizePLAB) {
     // See G1EvacStats::compute_desired_plab_sz for the reasoning why this is the
@@ -357,7 +358,7 @@ G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
   // The initial PLAB refill should not count, hence the +1 for the first boost.
   size_t initial_tolerated_refills = ResizePLAB ? _tolerated_refills + 1 : _tolerated_refills;
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
-    _dest_data[state].initialize(alloc_buffers_length(state), _g1h->desired_plab_sz(state), initial_tolerated_refills);
+    _dest_data[state].initialize(alloc_buffers_length(state), _g1h->desired_plab_sz(state, _worker_id), initial_tolerated_refills);
   }
 }
 
@@ -434,19 +435,23 @@ void G1PLABAllocator::undo_allocation(G1HeapRegionAttr dest, HeapWord* obj, size
 void G1PLABAllocator::flush_and_retire_stats(uint num_workers) {
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
     G1EvacStats* stats = _g1h->alloc_buffer_stats(state);
+    size_t used = 0;
     for (uint node_index = 0; node_index < alloc_buffers_length(state); node_index++) {
       PLAB* const buf = alloc_buffer(state, node_index);
       if (buf != nullptr) {
+        used += buf->used();
         buf->flush_and_retire_stats(stats);
       }
     }
+    stats->record_worker_used(_worker_id, used);
     PLABData* plab_data = &_dest_data[state];
     stats->add_num_plab_filled(plab_data->_num_plab_fills);
     stats->add_direct_allocated(plab_data->_direct_allocated);
     stats->add_num_direct_allocated(plab_data->_num_direct_allocations);
   }
 
-  log_trace(gc, plab)("PLAB boost: Young %zu -> %zu refills %zu (tolerated %zu) Old %zu -> %zu refills %zu (tolerated %zu)",
+  log_trace(gc, plab)("PLAB boost (worker %u): Young %zu -> %zu refills %zu (tolerated %zu) Old %zu -> %zu refills %zu (tolerated %zu)",
+                      _worker_id,
                       _g1h->alloc_buffer_stats(G1HeapRegionAttr::Young)->desired_plab_size(num_workers),
                       plab_size(G1HeapRegionAttr::Young),
                       _dest_data[G1HeapRegionAttr::Young]._num_plab_fills,
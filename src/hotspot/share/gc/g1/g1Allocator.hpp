@@ -151,6 +151,7 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
 
   G1CollectedHeap* _g1h;
   G1Allocator* _allocator;
+  uint const _worker_id;
 
   // Collects per-destination information (e.g. young, old gen) about current PLAB
   // and statistics about it.
@@ -196,7 +197,7 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
 public:
-  G1PLABAllocator(G1Allocator* allocator);
+  G1PLABAllocator(G1Allocator* allocator, uint worker_id);
 
   size_t waste() const;
   size_t undo_waste() const;
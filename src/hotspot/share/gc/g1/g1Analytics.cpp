@@ -25,7 +25,9 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1AnalyticsSequences.inline.hpp"
+#include "gc/g1/g1LinearCostModel.hpp"
 #include "gc/g1/g1Predictions.hpp"
+#include "gc/g1/g1_globals.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
@@ -88,6 +90,12 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _constant_other_time_ms_seq(TruncatedSeqLength),
     _young_other_cost_per_region_ms_seq(TruncatedSeqLength),
     _non_young_other_cost_per_region_ms_seq(TruncatedSeqLength),
+    _card_scan_cost_model(CostModelDecayFactor),
+    _card_merge_cost_model(CostModelDecayFactor),
+    _code_root_scan_cost_model(CostModelDecayFactor),
+    _object_copy_cost_model(CostModelDecayFactor),
+    _young_other_cost_model(CostModelDecayFactor),
+    _non_young_other_cost_model(CostModelDecayFactor),
     _recent_prev_end_times_for_all_gcs_sec(NumPrevPausesForHeuristics),
     _long_term_pause_time_ratio(0.0),
     _short_term_pause_time_ratio(0.0) {
@@ -181,32 +189,38 @@ void G1Analytics::report_dirtied_cards_in_thread_buffers(size_t cards) {
   _dirtied_cards_in_thread_buffers_seq.add(double(cards));
 }
 
-void G1Analytics::report_cost_per_card_scan_ms(double cost_per_card_ms, bool for_young_only_phase) {
-  _cost_per_card_scan_ms_seq.add(cost_per_card_ms, for_young_only_phase);
+void G1Analytics::report_card_scan_time_ms(double time_ms, size_t num_cards, bool for_young_only_phase) {
+  _cost_per_card_scan_ms_seq.add(time_ms / num_cards, for_young_only_phase);
+  _card_scan_cost_model.add(num_cards, time_ms, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_only_phase) {
-  _cost_per_card_merge_ms_seq.add(cost_per_card_ms, for_young_only_phase);
+void G1Analytics::report_card_merge_time_ms(double time_ms, size_t num_cards, bool for_young_only_phase) {
+  _cost_per_card_merge_ms_seq.add(time_ms / num_cards, for_young_only_phase);
+  _card_merge_cost_model.add(num_cards, time_ms, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase) {
-  _cost_per_code_root_ms_seq.add(cost_per_code_root_ms, for_young_only_phase);
+void G1Analytics::report_code_root_scan_time_ms(double time_ms, size_t num_code_roots, bool for_young_only_phase) {
+  _cost_per_code_root_ms_seq.add(time_ms / num_code_roots, for_young_only_phase);
+  _code_root_scan_cost_model.add(num_code_roots, time_ms, for_young_only_phase);
 }
 
 void G1Analytics::report_card_scan_to_merge_ratio(double merge_to_scan_ratio, bool for_young_only_phase) {
   _card_scan_to_merge_ratio_seq.add(merge_to_scan_ratio, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase) {
-  _cost_per_byte_copied_ms_seq.add(cost_per_byte_ms, for_young_only_phase);
+void G1Analytics::report_object_copy_time_ms(double time_ms, size_t bytes_copied, bool for_young_only_phase) {
+  _cost_per_byte_copied_ms_seq.add(time_ms / bytes_copied, for_young_only_phase);
+  _object_copy_cost_model.add(bytes_copied, time_ms, for_young_only_phase);
 }
 
-void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
-  _young_other_cost_per_region_ms_seq.add(other_cost_per_region_ms);
+void G1Analytics::report_young_other_time_ms(double time_ms, size_t num_regions) {
+  _young_other_cost_per_region_ms_seq.add(time_ms / num_regions);
+  _young_other_cost_model.add(num_regions, time_ms);
 }
 
-void G1Analytics::report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
-  _non_young_other_cost_per_region_ms_seq.add(other_cost_per_region_ms);
+void G1Analytics::report_non_young_other_time_ms(double time_ms, size_t num_regions) {
+  _non_young_other_cost_per_region_ms_seq.add(time_ms / num_regions);
+  _non_young_other_cost_model.add(num_regions, time_ms);
 }
 
 void G1Analytics::report_constant_other_time_ms(double constant_other_time_ms) {
@@ -249,19 +263,39 @@ size_t G1Analytics::predict_scan_card_num(size_t card_rs_length, bool for_young_
   return card_rs_length * predict_in_unit_interval(&_card_scan_to_merge_ratio_seq, for_young_only_phase);
 }
 
+bool G1Analytics::use_cost_model(G1PhaseDependentCostModel const* model, bool for_young_only_phase) {
+  return G1UseLinearCostModel && model->has_fit(for_young_only_phase);
+}
+
+bool G1Analytics::use_cost_model(G1LinearCostModel const* model) {
+  return G1UseLinearCostModel && model->has_fit();
+}
+
 double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_only_phase) const {
+  if (use_cost_model(&_card_merge_cost_model, for_young_only_phase)) {
+    return _card_merge_cost_model.predict_variable_cost(card_num, _predictor->sigma(), for_young_only_phase);
+  }
   return card_num * predict_zero_bounded(&_cost_per_card_merge_ms_seq, for_young_only_phase);
 }
 
 double G1Analytics::predict_code_root_scan_time_ms(size_t code_root_num, bool for_young_only_phase) const {
+  if (use_cost_model(&_code_root_scan_cost_model, for_young_only_phase)) {
+    return _code_root_scan_cost_model.predict_variable_cost(code_root_num, _predictor->sigma(), for_young_only_phase);
+  }
   return code_root_num * predict_zero_bounded(&_cost_per_code_root_ms_seq, for_young_only_phase);
 }
 
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_only_phase) const {
+  if (use_cost_model(&_card_scan_cost_model, for_young_only_phase)) {
+    return _card_scan_cost_model.predict_variable_cost(card_num, _predictor->sigma(), for_young_only_phase);
+  }
   return card_num * predict_zero_bounded(&_cost_per_card_scan_ms_seq, for_young_only_phase);
 }
 
 double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const {
+  if (use_cost_model(&_object_copy_cost_model, for_young_only_phase)) {
+    return _object_copy_cost_model.predict_variable_cost(bytes_to_copy, _predictor->sigma(), for_young_only_phase);
+  }
   return bytes_to_copy * predict_zero_bounded(&_cost_per_byte_copied_ms_seq, for_young_only_phase);
 }
 
@@ -269,11 +303,71 @@ double G1Analytics::predict_constant_other_time_ms() const {
   return predict_zero_bounded(&_constant_other_time_ms_seq);
 }
 
+double G1Analytics::predict_card_merge_fixed_cost_ms(bool for_young_only_phase) const {
+  if (use_cost_model(&_card_merge_cost_model, for_young_only_phase)) {
+    return _card_merge_cost_model.fixed_cost(for_young_only_phase);
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_card_scan_fixed_cost_ms(bool for_young_only_phase) const {
+  if (use_cost_model(&_card_scan_cost_model, for_young_only_phase)) {
+    return _card_scan_cost_model.fixed_cost(for_young_only_phase);
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_code_root_scan_fixed_cost_ms(bool for_young_only_phase) const {
+  if (use_cost_model(&_code_root_scan_cost_model, for_young_only_phase)) {
+    return _code_root_scan_cost_model.fixed_cost(for_young_only_phase);
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_object_copy_fixed_cost_ms(bool for_young_only_phase) const {
+  if (use_cost_model(&_object_copy_cost_model, for_young_only_phase)) {
+    return _object_copy_cost_model.fixed_cost(for_young_only_phase);
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_young_other_fixed_cost_ms() const {
+  if (use_cost_model(&_young_other_cost_model)) {
+    return _young_other_cost_model.fixed_cost();
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_non_young_other_fixed_cost_ms() const {
+  if (use_cost_model(&_non_young_other_cost_model)) {
+    return _non_young_other_cost_model.fixed_cost();
+  }
+  return 0.0;
+}
+
+double G1Analytics::predict_fixed_cost_ms(bool for_young_only_phase) const {
+  double result = predict_card_merge_fixed_cost_ms(for_young_only_phase) +
+                  predict_card_scan_fixed_cost_ms(for_young_only_phase) +
+                  predict_code_root_scan_fixed_cost_ms(for_young_only_phase) +
+                  predict_object_copy_fixed_cost_ms(for_young_only_phase) +
+                  predict_young_other_fixed_cost_ms();
+  if (!for_young_only_phase) {
+    result += predict_non_young_other_fixed_cost_ms();
+  }
+  return result;
+}
+
 double G1Analytics::predict_young_other_time_ms(size_t young_num) const {
+  if (use_cost_model(&_young_other_cost_model)) {
+    return _young_other_cost_model.predict_variable_cost(young_num, _predictor->sigma());
+  }
   return young_num * predict_zero_bounded(&_young_other_cost_per_region_ms_seq);
 }
 
 double G1Analytics::predict_non_young_other_time_ms(size_t non_young_num) const {
+  if (use_cost_model(&_non_young_other_cost_model)) {
+    return _non_young_other_cost_model.predict_variable_cost(non_young_num, _predictor->sigma());
+  }
   return non_young_num * predict_zero_bounded(&_non_young_other_cost_per_region_ms_seq);
 }
 
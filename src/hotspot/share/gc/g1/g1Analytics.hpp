@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1ANALYTICS_HPP
 
 #include "gc/g1/g1AnalyticsSequences.hpp"
+#include "gc/g1/g1LinearCostModel.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -35,6 +36,9 @@ class G1Predictions;
 class G1Analytics: public CHeapObj<mtGC> {
   const static int TruncatedSeqLength = 10;
   const static int NumPrevPausesForHeuristics = 10;
+  // Decay factor of previous samples in the linear cost models. Roughly
+  // corresponds to the window of the TruncatedSeqs.
+  static constexpr double CostModelDecayFactor = 1.0 - 1.0 / TruncatedSeqLength;
   const G1Predictions* _predictor;
 
   // These exclude marking times.
@@ -72,6 +76,15 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   TruncatedSeq _cost_per_byte_ms_during_cm_seq;
 
+  // Linear cost models with fixed and per-unit cost of the phases above. Used
+  // instead of the per-unit cost sequences above if G1UseLinearCostModel is set.
+  G1PhaseDependentCostModel _card_scan_cost_model;
+  G1PhaseDependentCostModel _card_merge_cost_model;
+  G1PhaseDependentCostModel _code_root_scan_cost_model;
+  G1PhaseDependentCostModel _object_copy_cost_model;
+  G1LinearCostModel _young_other_cost_model;
+  G1LinearCostModel _non_young_other_cost_model;
+
   // Statistics kept per GC stoppage, pause or full.
   TruncatedSeq _recent_prev_end_times_for_all_gcs_sec;
 
@@ -88,6 +101,9 @@ class G1Analytics: public CHeapObj<mtGC> {
   size_t predict_size(G1PhaseDependentSeq const* seq, bool for_young_only_phase) const;
   double predict_zero_bounded(G1PhaseDependentSeq const* seq, bool for_young_only_phase) const;
 
+  static bool use_cost_model(G1PhaseDependentCostModel const* model, bool for_young_only_phase);
+  static bool use_cost_model(G1LinearCostModel const* model);
+
   double oldest_known_gc_end_time_sec() const;
   double most_recent_gc_end_time_sec() const;
 
@@ -128,13 +144,13 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_concurrent_refine_rate_ms(double cards_per_ms);
   void report_dirtied_cards_rate_ms(double cards_per_ms);
   void report_dirtied_cards_in_thread_buffers(size_t num_cards);
-  void report_cost_per_card_scan_ms(double cost_per_remset_card_ms, bool for_young_only_phase);
-  void report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_only_phase);
-  void report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase);
+  void report_card_scan_time_ms(double time_ms, size_t num_cards, bool for_young_only_phase);
+  void report_card_merge_time_ms(double time_ms, size_t num_cards, bool for_young_only_phase);
+  void report_code_root_scan_time_ms(double time_ms, size_t num_code_roots, bool for_young_only_phase);
   void report_card_scan_to_merge_ratio(double cards_per_entry_ratio, bool for_young_only_phase);
-  void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase);
-  void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
-  void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
+  void report_object_copy_time_ms(double time_ms, size_t bytes_copied, bool for_young_only_phase);
+  void report_young_other_time_ms(double time_ms, size_t num_regions);
+  void report_non_young_other_time_ms(double time_ms, size_t num_regions);
   void report_constant_other_time_ms(double constant_other_time_ms);
   void report_pending_cards(double pending_cards, bool for_young_only_phase);
   void report_card_rs_length(double card_rs_length, bool for_young_only_phase);
@@ -160,6 +176,19 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   double predict_constant_other_time_ms() const;
 
+  // Fixed costs of the individual phases modeled by linear cost models. Zero
+  // unless G1UseLinearCostModel is set and the model has a fit.
+  double predict_card_merge_fixed_cost_ms(bool for_young_only_phase) const;
+  double predict_card_scan_fixed_cost_ms(bool for_young_only_phase) const;
+  double predict_code_root_scan_fixed_cost_ms(bool for_young_only_phase) const;
+  double predict_object_copy_fixed_cost_ms(bool for_young_only_phase) const;
+  double predict_young_other_fixed_cost_ms() const;
+  double predict_non_young_other_fixed_cost_ms() const;
+
+  // Sum of the fixed costs of the phases modeled by linear cost models. Zero
+  // unless G1UseLinearCostModel is set.
+  double predict_fixed_cost_ms(bool for_young_only_phase) const;
+
   double predict_young_other_time_ms(size_t young_num) const;
 
   double predict_non_young_other_time_ms(size_t non_young_num) const;
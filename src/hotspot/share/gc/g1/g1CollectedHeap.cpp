@@ -64,6 +64,7 @@
 #include "gc/g1/g1RegionPinCache.inline.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/g1RemSet.hpp"
+#include "gc/g1/g1RemSetTrimTask.hpp"
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1RootProcessor.hpp"
 #include "gc/g1/g1SATBMarkQueueSet.hpp"
@@ -139,8 +140,10 @@ void G1RegionMappingChangedListener::on_commit(uint start_idx, size_t num_region
 
 void G1CollectedHeap::run_batch_task(G1BatchedTask* cl) {
   uint num_workers = MAX2(1u, MIN2(cl->num_workers_estimate(), workers()->active_workers()));
+  num_workers = _batch_task_worker_feedback.num_workers(cl->name(), num_workers);
   cl->set_max_workers(num_workers);
   workers()->run_task(cl, num_workers);
+  _batch_task_worker_feedback.update(cl->name(), num_workers, workers());
 }
 
 uint G1CollectedHeap::get_chunks_per_region() {
@@ -1133,7 +1136,9 @@ G1CollectedHeap::G1CollectedHeap() :
   _service_thread(nullptr),
   _periodic_gc_task(nullptr),
   _free_arena_memory_task(nullptr),
+  _rem_set_trim_task(nullptr),
   _workers(nullptr),
+  _batch_task_worker_feedback(),
   _card_table(nullptr),
   _collection_pause_end(Ticks::now()),
   _old_set("Old Region Set", new OldRegionSetChecker()),
@@ -1410,6 +1415,9 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  _rem_set_trim_task = new G1RemSetTrimTask("Remembered Set Trim Task");
+  _service_thread->register_task(_rem_set_trim_task);
+
   // Here we allocate the dummy HeapRegion that is required by the
   // G1AllocRegion class.
   HeapRegion* dummy_region = _hrm.get_dummy_region();
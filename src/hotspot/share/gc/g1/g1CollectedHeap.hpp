@@ -53,6 +53,7 @@
 #include "gc/shared/plab.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/taskqueue.hpp"
+#include "gc/shared/workerPolicy.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
 #include "memory/memRegion.hpp"
@@ -77,6 +78,7 @@ class G1GCPhaseTimes;
 class G1HeapSizingPolicy;
 class G1NewTracer;
 class G1RemSet;
+class G1RemSetTrimTask;
 class G1ServiceTask;
 class G1ServiceThread;
 class GCMemoryManager;
@@ -172,8 +174,11 @@ class G1CollectedHeap : public CollectedHeap {
   G1ServiceThread* _service_thread;
   G1ServiceTask* _periodic_gc_task;
   G1MonotonicArenaFreeMemoryTask* _free_arena_memory_task;
+  G1RemSetTrimTask* _rem_set_trim_task;
 
   WorkerThreads* _workers;
+  // Per batched task feedback on the number of workers to use.
+  WorkerCountFeedback _batch_task_worker_feedback;
   G1CardTable* _card_table;
 
   Ticks _collection_pause_end;
@@ -531,6 +536,8 @@ class G1CollectedHeap : public CollectedHeap {
 
   G1ServiceThread* service_thread() const { return _service_thread; }
 
+  G1RemSetTrimTask* rem_set_trim_task() const { return _rem_set_trim_task; }
+
   WorkerThreads* workers() const { return _workers; }
 
   // Run the given batch task using the workers.
@@ -584,6 +591,7 @@ class G1CollectedHeap : public CollectedHeap {
 
   // Determines PLAB size for a given destination.
   inline size_t desired_plab_sz(G1HeapRegionAttr dest);
+  inline size_t desired_plab_sz(G1HeapRegionAttr dest, uint worker_id);
   // Clamp the given PLAB word size to allowed values. Prevents humongous PLAB sizes
   // for two reasons:
   // * PLABs are allocated using a similar paths as oops, but should
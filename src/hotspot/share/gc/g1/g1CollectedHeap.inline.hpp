@@ -96,6 +96,11 @@ size_t G1CollectedHeap::desired_plab_sz(G1HeapRegionAttr dest) {
   return clamp_plab_size(gclab_word_size);
 }
 
+size_t G1CollectedHeap::desired_plab_sz(G1HeapRegionAttr dest, uint worker_id) {
+  size_t gclab_word_size = alloc_buffer_stats(dest)->desired_plab_size(workers()->active_workers(), worker_id);
+  return clamp_plab_size(gclab_word_size);
+}
+
 inline size_t G1CollectedHeap::clamp_plab_size(size_t value) const {
   return clamp(value, PLAB::min_size(), _humongous_object_threshold_in_words);
 }
@@ -59,11 +59,13 @@ G1CollectionSet::G1CollectionSet(G1CollectedHeap* g1h, G1Policy* policy) :
   _initial_old_region_length(0),
   _optional_old_regions(),
   _inc_build_state(Inactive),
-  _inc_part_start(0) {
+  _inc_part_start(0),
+  _survivor_bytes_per_node(nullptr) {
 }
 
 G1CollectionSet::~G1CollectionSet() {
   FREE_C_HEAP_ARRAY(uint, _collection_set_regions);
+  FREE_C_HEAP_ARRAY(size_t, _survivor_bytes_per_node);
   abandon_all_candidates();
 }
 
@@ -79,6 +81,8 @@ void G1CollectionSet::init_region_lengths(uint eden_cset_region_length,
 
   _initial_old_region_length = 0;
   _optional_old_regions.clear();
+
+  memset(_survivor_bytes_per_node, 0, sizeof(size_t) * _g1h->numa()->num_active_nodes());
 }
 
 void G1CollectionSet::initialize(uint max_region_length) {
@@ -86,6 +90,10 @@ void G1CollectionSet::initialize(uint max_region_length) {
   _collection_set_max_length = max_region_length;
   _collection_set_regions = NEW_C_HEAP_ARRAY(uint, max_region_length, mtGC);
 
+  uint num_nodes = _g1h->numa()->num_active_nodes();
+  _survivor_bytes_per_node = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
+  memset(_survivor_bytes_per_node, 0, sizeof(size_t) * num_nodes);
+
   _candidates.initialize(max_region_length);
 }
 
@@ -124,6 +132,32 @@ void G1CollectionSet::finalize_incremental_building() {
   assert(SafepointSynchronize::is_at_safepoint(), "should be at a safepoint");
 }
 
+void G1CollectionSet::record_survivor_bytes_on_node(uint node_index, size_t bytes) {
+  assert(node_index < _g1h->numa()->num_active_nodes(), "Invalid node index %u", node_index);
+  _survivor_bytes_per_node[node_index] += bytes;
+}
+
+size_t G1CollectionSet::survivor_bytes_on_node(uint node_index) const {
+  assert(node_index < _g1h->numa()->num_active_nodes(), "Invalid node index %u", node_index);
+  return _survivor_bytes_per_node[node_index];
+}
+
+void G1CollectionSet::print_survivor_bytes_per_node() const {
+  G1NUMA* numa = _g1h->numa();
+  if (!numa->is_enabled()) {
+    return;
+  }
+  LogTarget(Debug, gc, heap, numa) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Survivor bytes per node:");
+    for (uint i = 0; i < numa->num_active_nodes(); i++) {
+      ls.print(" %u: " SIZE_FORMAT, numa->numa_id(i), _survivor_bytes_per_node[i]);
+    }
+    ls.cr();
+  }
+}
+
 void G1CollectionSet::clear() {
   assert_at_safepoint_on_vm_thread();
   _collection_set_cur_length = 0;
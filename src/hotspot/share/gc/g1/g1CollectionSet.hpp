@@ -162,6 +162,10 @@ class G1CollectionSet {
   CSetBuildType _inc_build_state;
   size_t _inc_part_start;
 
+  // Bytes copied into survivor regions during the current (or last) collection,
+  // indexed by memory node index.
+  size_t* _survivor_bytes_per_node;
+
   G1CollectorState* collector_state() const;
   G1GCPhaseTimes* phase_times();
 
@@ -276,6 +280,13 @@ class G1CollectionSet {
   // Add survivor region to the collection set.
   void add_survivor_regions(HeapRegion* hr);
 
+  // Record bytes copied into survivor regions located on the given memory node.
+  void record_survivor_bytes_on_node(uint node_index, size_t bytes);
+  // Returns the bytes copied into survivor regions on the given memory node during
+  // the current or last collection.
+  size_t survivor_bytes_on_node(uint node_index) const;
+  void print_survivor_bytes_per_node() const;
+
 #ifndef PRODUCT
   bool verify_young_ages();
 
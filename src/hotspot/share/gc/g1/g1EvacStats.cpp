@@ -127,7 +127,8 @@ G1EvacStats::G1EvacStats(const char* description, size_t default_per_thread_plab
   _direct_allocated(0),
   _num_direct_allocated(0),
   _failure_used(0),
-  _failure_waste(0) {
+  _failure_waste(0),
+  _worker_sizing(ParallelGCThreads, wt, G1LastPLABAverageOccupancy) {
 }
 
 // Calculates plab size for current number of gc worker threads.
@@ -140,6 +141,16 @@ size_t G1EvacStats::desired_plab_size(uint no_of_gc_workers) const {
   return align_object_size(clamp(_desired_net_plab_size / no_of_gc_workers, min_size(), max_size()));
 }
 
+size_t G1EvacStats::desired_plab_size(uint no_of_gc_workers, uint worker_id) const {
+  if (ResizePLAB && ResizePLABPerWorker) {
+    size_t worker_size = _worker_sizing.desired_plab_size(worker_id);
+    if (worker_size != 0) {
+      return worker_size;
+    }
+  }
+  return desired_plab_size(no_of_gc_workers);
+}
+
 void G1EvacStats::adjust_desired_plab_size() {
   log_plab_allocation();
 
@@ -50,6 +50,9 @@ class G1EvacStats : public PLABStats {
   // end of regions.
   size_t _failure_waste;
 
+  // Per-worker sizing history, used with ResizePLABPerWorker.
+  PLABWorkerSizing _worker_sizing;
+
   virtual void reset() {
     PLABStats::reset();
     _region_end_waste = 0;
@@ -71,6 +74,12 @@ class G1EvacStats : public PLABStats {
 
   // Calculates plab size for current number of gc worker threads.
   size_t desired_plab_size(uint no_of_gc_workers) const;
+  // Calculates plab size for the given worker, falling back to the size for
+  // all workers if there is no per-worker history.
+  size_t desired_plab_size(uint no_of_gc_workers, uint worker_id) const;
+
+  // Record the words the given worker used in its PLABs during this GC.
+  void record_worker_used(uint worker_id, size_t used) { _worker_sizing.record(worker_id, used); }
 
   // Computes the new desired PLAB size assuming one gc worker thread, updating
   // _desired_plab_sz, and clearing statistics for the next GC.
@@ -32,8 +32,80 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
 #include "utilities/ticks.hpp"
 
+G1FullGCCompactTask::G1CompactionQueueClaimer::G1CompactionQueueClaimer(G1FullGCCompactionPoint* cp) :
+    _cp(cp),
+    _next_to_claim(0),
+    _completed_prefix(0),
+    _completed(nullptr) {
+  _completed = NEW_C_HEAP_ARRAY(volatile bool, MAX2(length(), 1), mtGC);
+  for (int i = 0; i < length(); i++) {
+    _completed[i] = false;
+  }
+}
+
+G1FullGCCompactTask::G1CompactionQueueClaimer::~G1CompactionQueueClaimer() {
+  FREE_C_HEAP_ARRAY(volatile bool, _completed);
+}
+
+bool G1FullGCCompactTask::G1CompactionQueueClaimer::is_exhausted() const {
+  return Atomic::load(&_next_to_claim) >= length();
+}
+
+bool G1FullGCCompactTask::G1CompactionQueueClaimer::try_claim(int& index) {
+  int next = Atomic::load(&_next_to_claim);
+  if (next >= length()) {
+    return false;
+  }
+  // Every earlier region the claimed region compacts into must have been vacated
+  // before. As the destinations of a region are always at or before the last
+  // destination, completion of all regions up to there is sufficient.
+  int required_prefix = MIN2(_cp->last_destination(next) + 1, next);
+  if (Atomic::load_acquire(&_completed_prefix) < required_prefix) {
+    return false;
+  }
+  if (Atomic::cmpxchg(&_next_to_claim, next, next + 1) != next) {
+    return false;
+  }
+  index = next;
+  return true;
+}
+
+void G1FullGCCompactTask::G1CompactionQueueClaimer::set_completed(int index) {
+  Atomic::release_store_fence(&_completed[index], true);
+  // Advance the prefix of completed regions as far as possible. Completions may
+  // happen out of order, so whoever completes the region at the current prefix
+  // moves it past all regions completed in the meantime.
+  int prefix = Atomic::load(&_completed_prefix);
+  while (prefix < length() && Atomic::load_acquire(&_completed[prefix])) {
+    Atomic::cmpxchg(&_completed_prefix, prefix, prefix + 1);
+    prefix = Atomic::load(&_completed_prefix);
+  }
+}
+
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+    G1FullGCTask("G1 Compact Task", collector),
+    _collector(collector),
+    _claimer(collector->workers()),
+    _g1h(G1CollectedHeap::heap()),
+    _num_queues(collector->workers()),
+    _queue_claimers(nullptr) {
+  _queue_claimers = NEW_C_HEAP_ARRAY(G1CompactionQueueClaimer, _num_queues, mtGC);
+  for (uint i = 0; i < _num_queues; i++) {
+    ::new (&_queue_claimers[i]) G1CompactionQueueClaimer(collector->compaction_point(i));
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  for (uint i = 0; i < _num_queues; i++) {
+    _queue_claimers[i].~G1CompactionQueueClaimer();
+  }
+  FREE_C_HEAP_ARRAY(G1CompactionQueueClaimer, _queue_claimers);
+}
+
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
   assert(_bitmap->is_marked(obj), "Should only compact marked objects");
   _bitmap->clear(obj);
@@ -87,12 +159,42 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
 
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
-  }
+  uint own_regions = 0;
+  uint stolen_regions = 0;
+  SpinYield spin_yield;
+
+  // Compact regions from the own queue first, then help with the other queues.
+  // Regions are claimed one at a time, so a few dense regions at the head of one
+  // queue do not keep the remaining workers idle.
+  bool all_exhausted;
+  do {
+    all_exhausted = true;
+    bool claimed_any = false;
+    for (uint i = 0; i < _num_queues; i++) {
+      uint queue_idx = (worker_id + i) % _num_queues;
+      G1CompactionQueueClaimer* claimer = &_queue_claimers[queue_idx];
+      int index;
+      while (claimer->try_claim(index)) {
+        compact_region(claimer->region_at(index));
+        claimer->set_completed(index);
+        claimed_any = true;
+        if (queue_idx == worker_id) {
+          own_regions++;
+        } else {
+          stolen_regions++;
+        }
+      }
+      all_exhausted &= claimer->is_exhausted();
+    }
+    if (!claimed_any && !all_exhausted) {
+      // Remaining regions wait for their destinations to be compacted by others.
+      spin_yield.wait();
+    }
+  } while (!all_exhausted);
+
+  log_task("Compaction task", worker_id, start);
+  log_trace(gc, phases)("Compaction task (%u) regions: own %u stolen %u",
+                        worker_id, own_regions, stolen_regions);
 }
 
 void G1FullGCCompactTask::serial_compaction() {
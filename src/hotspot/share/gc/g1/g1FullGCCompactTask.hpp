@@ -36,9 +36,35 @@ class G1CMBitMap;
 class G1FullCollector;
 
 class G1FullGCCompactTask : public G1FullGCTask {
+  // Claims regions of a single compaction queue for compaction. Regions are handed
+  // out in queue order, but a region may only be compacted after all earlier
+  // regions it slides objects into have been compacted themselves. Any worker
+  // may claim from any queue within that window of completed regions, which
+  // allows idle workers to steal from the queues of busy ones.
+  class G1CompactionQueueClaimer {
+    G1FullGCCompactionPoint* _cp;
+    volatile int _next_to_claim;
+    volatile int _completed_prefix;
+    volatile bool* _completed;
+
+    int length() const { return _cp->regions()->length(); }
+
+  public:
+    G1CompactionQueueClaimer(G1FullGCCompactionPoint* cp);
+    ~G1CompactionQueueClaimer();
+
+    bool is_exhausted() const;
+    HeapRegion* region_at(int index) const { return _cp->regions()->at(index); }
+    // Claim the next region of the queue if it can be compacted now.
+    bool try_claim(int& index);
+    void set_completed(int index);
+  };
+
   G1FullCollector* _collector;
   HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
+  uint _num_queues;
+  G1CompactionQueueClaimer* _queue_claimers;
 
   void compact_region(HeapRegion* hr);
   void compact_humongous_obj(HeapRegion* hr);
@@ -47,11 +73,8 @@ class G1FullGCCompactTask : public G1FullGCTask {
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
   void serial_compaction();
@@ -34,13 +34,16 @@ G1FullGCCompactionPoint::G1FullGCCompactionPoint(G1FullCollector* collector, Pre
     _collector(collector),
     _current_region(nullptr),
     _compaction_top(nullptr),
-    _preserved_stack(preserved_stack) {
+    _preserved_stack(preserved_stack),
+    _current_index(0) {
   _compaction_regions = new (mtGC) GrowableArray<HeapRegion*>(32, mtGC);
   _compaction_region_iterator = _compaction_regions->begin();
+  _last_destinations = new (mtGC) GrowableArray<int>(32, mtGC);
 }
 
 G1FullGCCompactionPoint::~G1FullGCCompactionPoint() {
   delete _compaction_regions;
+  delete _last_destinations;
 }
 
 void G1FullGCCompactionPoint::update() {
@@ -72,6 +75,7 @@ HeapRegion* G1FullGCCompactionPoint::current_region() {
 
 HeapRegion* G1FullGCCompactionPoint::next_region() {
   HeapRegion* next = *(++_compaction_region_iterator);
+  _current_index++;
   assert(next != nullptr, "Must return valid region");
   return next;
 }
@@ -80,6 +84,16 @@ GrowableArray<HeapRegion*>* G1FullGCCompactionPoint::regions() {
   return _compaction_regions;
 }
 
+void G1FullGCCompactionPoint::record_last_destination() {
+  assert(is_initialized(), "Must have been initialized");
+  assert(_current_index <= _last_destinations->length(), "destination must precede source");
+  _last_destinations->append(_current_index);
+}
+
+int G1FullGCCompactionPoint::last_destination(int queue_index) const {
+  return _last_destinations->at(queue_index);
+}
+
 bool G1FullGCCompactionPoint::object_will_fit(size_t size) {
   size_t space_left = pointer_delta(_current_region->end(), _compaction_top);
   return size <= space_left;
@@ -134,6 +148,10 @@ void G1FullGCCompactionPoint::remove_at_or_above(uint bottom) {
 
   assert(start_index >= 0, "Should have at least one region");
   _compaction_regions->trunc_to(start_index);
+  if (_last_destinations->length() > start_index) {
+    // Regions kept in the queue only ever forward into regions before them.
+    _last_destinations->trunc_to(start_index);
+  }
 }
 
 void G1FullGCCompactionPoint::add_humongous(HeapRegion* hr) {
@@ -41,6 +41,10 @@ class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
   PreservedMarks* _preserved_stack;
   GrowableArray<HeapRegion*>* _compaction_regions;
   GrowableArrayIterator<HeapRegion*> _compaction_region_iterator;
+  int _current_index;
+  // For every region in the compaction queue, the queue index of the last region
+  // its live objects have been forwarded into.
+  GrowableArray<int>* _last_destinations;
 
   bool object_will_fit(size_t size);
   void initialize_values();
@@ -64,6 +68,11 @@ class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
   void remove_at_or_above(uint bottom);
   HeapRegion* current_region();
 
+  // Record the current compaction region as the last destination of the queue
+  // region that has just been prepared. Must be called in queue order.
+  void record_last_destination();
+  int last_destination(int queue_index) const;
+
   GrowableArray<HeapRegion*>* regions();
 
   PreservedMarks* preserved_stack() const {
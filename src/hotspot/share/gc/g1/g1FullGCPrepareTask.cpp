@@ -82,6 +82,7 @@ void G1FullGCPrepareTask::work(uint worker_id) {
          it != compaction_point->regions()->end();
          ++it) {
       closure.do_heap_region(*it);
+      compaction_point->record_last_destination();
     }
     compaction_point->update();
     // Determine if there are any unused compaction targets. This is only the case if
@@ -147,9 +147,15 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
 
   _gc_par_phases[SampleCollectionSetCandidates] = new WorkerDataArray<double>("SampleCandidates", "Sample CSet Candidates (ms):", max_gc_threads);
 
-  _gc_par_phases[Termination]->create_thread_work_items("Termination Attempts:");
-
-  _gc_par_phases[OptTermination]->create_thread_work_items("Optional Termination Attempts:");
+  _gc_par_phases[Termination]->create_thread_work_items("Termination Attempts:", TerminationAttempts);
+  _gc_par_phases[Termination]->create_thread_work_items("Attempts < 0.1ms:", TerminationAttemptsShort);
+  _gc_par_phases[Termination]->create_thread_work_items("Attempts < 1ms:", TerminationAttemptsMedium);
+  _gc_par_phases[Termination]->create_thread_work_items("Attempts >= 1ms:", TerminationAttemptsLong);
+
+  _gc_par_phases[OptTermination]->create_thread_work_items("Optional Termination Attempts:", TerminationAttempts);
+  _gc_par_phases[OptTermination]->create_thread_work_items("Attempts < 0.1ms:", TerminationAttemptsShort);
+  _gc_par_phases[OptTermination]->create_thread_work_items("Attempts < 1ms:", TerminationAttemptsMedium);
+  _gc_par_phases[OptTermination]->create_thread_work_items("Attempts >= 1ms:", TerminationAttemptsLong);
 
   _gc_par_phases[RedirtyCards] = new WorkerDataArray<double>("RedirtyCards", "Redirty Logged Cards (ms):", max_gc_threads);
   _gc_par_phases[RedirtyCards]->create_thread_work_items("Redirtied Cards:");
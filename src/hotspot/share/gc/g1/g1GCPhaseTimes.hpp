@@ -159,6 +159,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     RemoveSelfForwardObjectsBytes,
   };
 
+  // Termination attempts, and a histogram of how long individual attempts took.
+  enum GCTerminationWorkItems {
+    TerminationAttempts,
+    TerminationAttemptsShort,     // Attempts that took less than 0.1ms.
+    TerminationAttemptsMedium,    // Attempts that took less than 1ms.
+    TerminationAttemptsLong       // All other attempts.
+  };
+
   enum GCEagerlyReclaimHumongousObjectsItems {
     EagerlyReclaimNumTotal,
     EagerlyReclaimNumCandidates,
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearCostModel.hpp"
+#include "utilities/debug.hpp"
+
+#include <math.h>
+
+G1LinearCostModel::G1LinearCostModel(double decay_factor) :
+  _decay_factor(decay_factor),
+  _sum_weights(0.0),
+  _sum_x(0.0),
+  _sum_y(0.0),
+  _sum_xx(0.0),
+  _sum_xy(0.0),
+  _sum_yy(0.0),
+  _num_samples(0),
+  _fixed_cost(0.0),
+  _unit_cost(0.0),
+  _unit_cost_stddev(0.0),
+  _residual_stddev(0.0) {
+  assert(decay_factor > 0.0 && decay_factor <= 1.0, "Decay factor must be in (0, 1] but is %f", decay_factor);
+}
+
+void G1LinearCostModel::add(double units, double time_ms) {
+  assert(units >= 0.0, "Number of units must be non-negative but is %f", units);
+
+  _sum_weights = _sum_weights * _decay_factor + 1.0;
+  _sum_x = _sum_x * _decay_factor + units;
+  _sum_y = _sum_y * _decay_factor + time_ms;
+  _sum_xx = _sum_xx * _decay_factor + units * units;
+  _sum_xy = _sum_xy * _decay_factor + units * time_ms;
+  _sum_yy = _sum_yy * _decay_factor + time_ms * time_ms;
+  _num_samples++;
+
+  update_fit();
+}
+
+double G1LinearCostModel::residual_variance(double fixed_cost, double unit_cost) const {
+  // Weighted mean of (y - fixed_cost - unit_cost * x)^2 expanded in terms of the sums.
+  double a = fixed_cost;
+  double b = unit_cost;
+  double sum_sq = _sum_yy
+                  - 2.0 * a * _sum_y
+                  - 2.0 * b * _sum_xy
+                  + a * a * _sum_weights
+                  + 2.0 * a * b * _sum_x
+                  + b * b * _sum_xx;
+  return MAX2(sum_sq / _sum_weights, 0.0);
+}
+
+void G1LinearCostModel::update_fit() {
+  double const mean_x = _sum_x / _sum_weights;
+  double const mean_y = _sum_y / _sum_weights;
+  double const var_x = _sum_xx / _sum_weights - mean_x * mean_x;
+  double const cov_xy = _sum_xy / _sum_weights - mean_x * mean_y;
+
+  // Without sufficient spread in the number of units, or if the regular fit
+  // results in negative costs, fall back to a model without fixed cost.
+  bool through_origin = var_x <= (mean_x * mean_x) * 1e-6;
+  double a = 0.0;
+  double b = 0.0;
+  if (!through_origin) {
+    b = cov_xy / var_x;
+    a = mean_y - b * mean_x;
+    through_origin = a < 0.0 || b < 0.0;
+  }
+  if (through_origin) {
+    a = 0.0;
+    b = _sum_xx > 0.0 ? MAX2(_sum_xy / _sum_xx, 0.0) : 0.0;
+  }
+
+  double const var_res = residual_variance(a, b);
+  double const var_b_denominator = through_origin ? _sum_xx : var_x * _sum_weights;
+
+  _fixed_cost = a;
+  _unit_cost = b;
+  _residual_stddev = sqrt(var_res);
+  _unit_cost_stddev = var_b_denominator > 0.0 ? sqrt(var_res / var_b_denominator) : 0.0;
+}
+
+G1PhaseDependentCostModel::G1PhaseDependentCostModel(double decay_factor) :
+  _young_only_model(decay_factor),
+  _mixed_model(decay_factor) { }
+
+const G1LinearCostModel* G1PhaseDependentCostModel::model(bool for_young_only_phase) const {
+  if (for_young_only_phase || !_mixed_model.has_fit()) {
+    return &_young_only_model;
+  }
+  return &_mixed_model;
+}
+
+void G1PhaseDependentCostModel::add(double units, double time_ms, bool for_young_only_phase) {
+  if (for_young_only_phase) {
+    _young_only_model.add(units, time_ms);
+  } else {
+    _mixed_model.add(units, time_ms);
+  }
+}
+
+bool G1PhaseDependentCostModel::has_fit(bool for_young_only_phase) const {
+  return model(for_young_only_phase)->has_fit();
+}
+
+double G1PhaseDependentCostModel::fixed_cost(bool for_young_only_phase) const {
+  return model(for_young_only_phase)->fixed_cost();
+}
+
+double G1PhaseDependentCostModel::predict_variable_cost(double units, double sigma, bool for_young_only_phase) const {
+  return model(for_young_only_phase)->predict_variable_cost(units, sigma);
+}
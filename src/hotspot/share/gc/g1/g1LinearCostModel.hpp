@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1LINEARCOSTMODEL_HPP
+#define SHARE_GC_G1_G1LINEARCOSTMODEL_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+// Linear cost model of a GC phase, i.e.
+//
+//   time_ms = fixed_cost_ms + unit_cost_ms * units
+//
+// where units is the amount of work items (cards, bytes, regions, ...) processed
+// in that phase. The model is fitted by online weighted least squares; previous
+// samples are decayed by a constant factor on every new sample so that the model
+// follows workload changes.
+//
+// Predictions use the upper confidence bound of the unit cost, using the
+// standard error of the unit cost estimate.
+class G1LinearCostModel {
+  static const uint MinNumSamples = 3;
+
+  double _decay_factor;
+
+  // Weighted sums of the samples.
+  double _sum_weights;
+  double _sum_x;
+  double _sum_y;
+  double _sum_xx;
+  double _sum_xy;
+  double _sum_yy;
+  uint _num_samples;
+
+  // Current fit, updated on every sample.
+  double _fixed_cost;
+  double _unit_cost;
+  double _unit_cost_stddev;
+  double _residual_stddev;
+
+  // Residual variance of the given fit.
+  double residual_variance(double fixed_cost, double unit_cost) const;
+  void update_fit();
+
+public:
+  G1LinearCostModel(double decay_factor);
+
+  void add(double units, double time_ms);
+
+  uint num_samples() const { return _num_samples; }
+  bool has_fit() const { return _num_samples >= MinNumSamples; }
+
+  double fixed_cost() const { return _fixed_cost; }
+  double unit_cost() const { return _unit_cost; }
+  double unit_cost_stddev() const { return _unit_cost_stddev; }
+  double residual_stddev() const { return _residual_stddev; }
+
+  // Predicted time to process the given units excluding the fixed cost, at a
+  // confidence of sigma standard deviations.
+  double predict_variable_cost(double units, double sigma) const {
+    return units * (_unit_cost + sigma * _unit_cost_stddev);
+  }
+
+  // Predicted time to process the given units including the fixed cost.
+  double predict(double units, double sigma) const {
+    return _fixed_cost + predict_variable_cost(units, sigma);
+  }
+};
+
+// Container for G1LinearCostModels that need separate models by GC phase.
+class G1PhaseDependentCostModel {
+  G1LinearCostModel _young_only_model;
+  G1LinearCostModel _mixed_model;
+
+  const G1LinearCostModel* model(bool for_young_only_phase) const;
+
+public:
+  G1PhaseDependentCostModel(double decay_factor);
+
+  void add(double units, double time_ms, bool for_young_only_phase);
+
+  bool has_fit(bool for_young_only_phase) const;
+  double fixed_cost(bool for_young_only_phase) const;
+  double predict_variable_cost(double units, double sigma, bool for_young_only_phase) const;
+};
+
+#endif // SHARE_GC_G1_G1LINEARCOSTMODEL_HPP
@@ -85,6 +85,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
     _obj_alloc_stat(nullptr),
+    _worker_node_index(g1h->numa()->index_of_current_thread()),
+    _surviving_words_per_node(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
     _evacuation_failed_info(),
@@ -102,7 +104,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
   _surviving_young_words = _surviving_young_words_base + padding_elem_num;
   memset(_surviving_young_words, 0, _surviving_words_length * sizeof(size_t));
 
-  _plab_allocator = new G1PLABAllocator(_g1h->allocator());
+  _plab_allocator = new G1PLABAllocator(_g1h->allocator(), _worker_id);
 
   _closures = G1EvacuationRootClosures::create_root_closures(_g1h,
                                                              this,
@@ -138,6 +140,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _surviving_words_per_node);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -234,10 +237,12 @@ void G1ParScanThreadState::do_partial_array(PartialArrayScanTask task) {
   assert(to_obj->is_objArray(), "must be obj array");
   objArrayOop to_array = objArrayOop(to_obj);
 
+  int chunk_size = _partial_array_stepper.chunk_size(objArrayOop(from_obj)->length(),
+                                                     _partial_objarray_chunk_size);
   PartialArrayTaskStepper::Step step
     = _partial_array_stepper.next(objArrayOop(from_obj),
                                   to_array,
-                                  _partial_objarray_chunk_size);
+                                  chunk_size);
   for (uint i = 0; i < step._ncreate; ++i) {
     push_on_queue(ScannerTask(PartialArrayScanTask(from_obj)));
   }
@@ -249,7 +254,7 @@ void G1ParScanThreadState::do_partial_array(PartialArrayScanTask task) {
   // on start/end.
   to_array->oop_iterate_range(&_scanner,
                               step._index,
-                              step._index + _partial_objarray_chunk_size);
+                              step._index + chunk_size);
 }
 
 MAYBE_INLINE_EVACUATION
@@ -264,10 +269,12 @@ void G1ParScanThreadState::start_partial_objarray(G1HeapRegionAttr dest_attr,
 
   objArrayOop to_array = objArrayOop(to_obj);
 
+  int chunk_size = _partial_array_stepper.chunk_size(objArrayOop(from_obj)->length(),
+                                                     _partial_objarray_chunk_size);
   PartialArrayTaskStepper::Step step
     = _partial_array_stepper.start(objArrayOop(from_obj),
                                    to_array,
-                                   _partial_objarray_chunk_size);
+                                   chunk_size);
 
   // Push any needed partial scan tasks.  Pushed before processing the
   // initial chunk to allow other workers to steal while we're processing.
@@ -469,7 +476,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
-  uint node_index = from_region->node_index();
+  uint node_index = evacuation_node_index(from_region);
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
 
@@ -520,6 +527,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
         obj->incr_age();
       }
       _age_table.add(age, word_sz);
+      _surviving_words_per_node[node_index] += word_sz;
     } else {
       update_bot_after_copying(obj, word_sz);
     }
@@ -606,6 +614,10 @@ void G1ParScanThreadStateSet::flush_stats() {
     size_t copied_bytes = pss->flush_stats(_surviving_young_words_total, _num_workers, &_rdc_buffers[worker_id]) * HeapWordSize;
     size_t evac_fail_enqueued_cards = pss->evac_failure_enqueued_cards();
 
+    for (uint node_index = 0; node_index < _g1h->numa()->num_active_nodes(); node_index++) {
+      _collection_set->record_survivor_bytes_on_node(node_index, pss->surviving_words_on_node(node_index) * HeapWordSize);
+    }
+
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_undo_waste_bytes, G1GCPhaseTimes::MergePSSLABUndoWasteBytes);
@@ -615,6 +627,8 @@ void G1ParScanThreadStateSet::flush_stats() {
     _states[worker_id] = nullptr;
   }
 
+  _collection_set->print_survivor_bytes_per_node();
+
   G1DirtyCardQueueSet& dcq = G1BarrierSet::dirty_card_queue_set();
   dcq.merge_bufferlists(rdcqs());
   rdcqs()->verify_empty();
@@ -676,6 +690,10 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
 }
 
 void G1ParScanThreadState::initialize_numa_stats() {
+  uint num_nodes = _numa->num_active_nodes();
+  _surviving_words_per_node = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
+  memset(_surviving_words_per_node, 0, sizeof(size_t) * num_nodes);
+
   if (_numa->is_enabled()) {
     LogTarget(Info, gc, heap, numa) lt;
 
@@ -701,6 +719,18 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+uint G1ParScanThreadState::evacuation_node_index(const HeapRegion* from_region) const {
+  if (G1NUMAEvacuateToWorkerNode && _worker_node_index != G1NUMA::UnknownNodeIndex) {
+    return _worker_node_index;
+  }
+  return from_region->node_index();
+}
+
+size_t G1ParScanThreadState::surviving_words_on_node(uint node_index) const {
+  assert(node_index < _numa->num_active_nodes(), "Invalid node index %u", node_index);
+  return _surviving_words_per_node[node_index];
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
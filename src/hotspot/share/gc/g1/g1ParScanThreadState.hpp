@@ -102,6 +102,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Node index of the memory node this worker thread executes on, determined
+  // when the thread state is created by the worker.
+  uint _worker_node_index;
+  // Number of words copied into survivor regions per memory node.
+  size_t* _surviving_words_per_node;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -168,6 +173,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // HeapWords copied.
   size_t flush_stats(size_t* surviving_young_words, uint num_workers, BufferNodeList* buffer_log);
 
+  // Number of words this thread copied into survivor regions on the given node.
+  size_t surviving_words_on_node(uint node_index) const;
+
 private:
   void do_partial_array(PartialArrayScanTask task);
   void start_partial_objarray(G1HeapRegionAttr dest_dir, oop from, oop to);
@@ -220,6 +228,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
 
+  // Returns the node index of the destination PLAB for objects evacuated from
+  // the given region.
+  inline uint evacuation_node_index(const HeapRegion* from_region) const;
+
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
 
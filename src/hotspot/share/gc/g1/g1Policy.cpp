@@ -40,6 +40,7 @@
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
@@ -880,7 +881,10 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
                                     average_time_ms(G1GCPhaseTimes::MergeLB) +
                                     p->cur_distribute_log_buffers_time_ms() +
                                     average_time_ms(G1GCPhaseTimes::OptMergeRS);
-      _analytics->report_cost_per_card_merge_ms(avg_time_merge_cards / total_cards_merged, is_young_only_pause);
+      report_cost_prediction("Merge Cards", total_cards_merged, avg_time_merge_cards,
+                             _analytics->predict_card_merge_time_ms(total_cards_merged, is_young_only_pause) +
+                             _analytics->predict_card_merge_fixed_cost_ms(is_young_only_pause));
+      _analytics->report_card_merge_time_ms(avg_time_merge_cards, total_cards_merged, is_young_only_pause);
     }
 
     // Update prediction for card scan
@@ -891,7 +895,10 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       double avg_time_dirty_card_scan = average_time_ms(G1GCPhaseTimes::ScanHR) +
                                         average_time_ms(G1GCPhaseTimes::OptScanHR);
 
-      _analytics->report_cost_per_card_scan_ms(avg_time_dirty_card_scan / total_cards_scanned, is_young_only_pause);
+      report_cost_prediction("Scan Cards", total_cards_scanned, avg_time_dirty_card_scan,
+                             _analytics->predict_card_scan_time_ms(total_cards_scanned, is_young_only_pause) +
+                             _analytics->predict_card_scan_fixed_cost_ms(is_young_only_pause));
+      _analytics->report_card_scan_time_ms(avg_time_dirty_card_scan, total_cards_scanned, is_young_only_pause);
     }
 
     // Update prediction for the ratio between cards from the remembered
@@ -913,25 +920,37 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       double avg_time_code_root_scan = average_time_ms(G1GCPhaseTimes::CodeRoots) +
                                        average_time_ms(G1GCPhaseTimes::OptCodeRoots);
 
-      _analytics->report_cost_per_code_root_scan_ms(avg_time_code_root_scan / total_code_roots_scanned, is_young_only_pause);
+      report_cost_prediction("Scan Code Roots", total_code_roots_scanned, avg_time_code_root_scan,
+                             _analytics->predict_code_root_scan_time_ms(total_code_roots_scanned, is_young_only_pause) +
+                             _analytics->predict_code_root_scan_fixed_cost_ms(is_young_only_pause));
+      _analytics->report_code_root_scan_time_ms(avg_time_code_root_scan, total_code_roots_scanned, is_young_only_pause);
     }
 
     // Update prediction for copy cost per byte
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
-      _analytics->report_cost_per_byte_ms(cost_per_byte_ms, is_young_only_pause);
+      double copy_time_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
+      report_cost_prediction("Object Copy", copied_bytes, copy_time_ms,
+                             _analytics->predict_object_copy_time_ms(copied_bytes, is_young_only_pause) +
+                             _analytics->predict_object_copy_fixed_cost_ms(is_young_only_pause));
+      _analytics->report_object_copy_time_ms(copy_time_ms, copied_bytes, is_young_only_pause);
     }
 
-    if (_collection_set->young_region_length() > 0) {
-      _analytics->report_young_other_cost_per_region_ms(young_other_time_ms() /
-                                                        _collection_set->young_region_length());
+    uint const young_region_length = _collection_set->young_region_length();
+    if (young_region_length > 0) {
+      report_cost_prediction("Young Other", young_region_length, young_other_time_ms(),
+                             _analytics->predict_young_other_time_ms(young_region_length) +
+                             _analytics->predict_young_other_fixed_cost_ms());
+      _analytics->report_young_other_time_ms(young_other_time_ms(), young_region_length);
     }
 
-    if (_collection_set->initial_old_region_length() > 0) {
-      _analytics->report_non_young_other_cost_per_region_ms(non_young_other_time_ms() /
-                                                            _collection_set->initial_old_region_length());
+    uint const old_region_length = _collection_set->initial_old_region_length();
+    if (old_region_length > 0) {
+      report_cost_prediction("Non-Young Other", old_region_length, non_young_other_time_ms(),
+                             _analytics->predict_non_young_other_time_ms(old_region_length) +
+                             _analytics->predict_non_young_other_fixed_cost_ms());
+      _analytics->report_non_young_other_time_ms(non_young_other_time_ms(), old_region_length);
     }
 
     _analytics->report_constant_other_time_ms(constant_other_time_ms(pause_time_ms));
@@ -1050,6 +1069,12 @@ void G1Policy::update_ihop_prediction(double mutator_time_s,
   }
 }
 
+void G1Policy::report_cost_prediction(const char* phase, size_t units, double actual_time_ms, double predicted_time_ms) const {
+  log_trace(gc, ergo)("Cost prediction %s: units %zu actual %1.3fms predicted %1.3fms",
+                      phase, units, actual_time_ms, predicted_time_ms);
+  _g1h->gc_tracer_stw()->report_cost_prediction(phase, units, predicted_time_ms, actual_time_ms);
+}
+
 void G1Policy::report_ihop_statistics() {
   _ihop_control->print();
 }
@@ -1072,7 +1097,8 @@ double G1Policy::predict_base_time_ms(size_t pending_cards,
   double card_merge_time = _analytics->predict_card_merge_time_ms(pending_cards + card_rs_length, in_young_only_phase);
   double card_scan_time = _analytics->predict_card_scan_time_ms(effective_scanned_cards, in_young_only_phase);
   double code_root_scan_time = _analytics->predict_code_root_scan_time_ms(code_root_rs_length, in_young_only_phase);
-  double constant_other_time = _analytics->predict_constant_other_time_ms();
+  double constant_other_time = _analytics->predict_constant_other_time_ms() +
+                               _analytics->predict_fixed_cost_ms(in_young_only_phase);
   double survivor_evac_time = predict_survivor_regions_evac_time();
 
   double total_time = card_merge_time + card_scan_time + code_root_scan_time + constant_other_time + survivor_evac_time;
@@ -65,6 +65,10 @@ class G1Policy: public CHeapObj<mtGC> {
   void update_ihop_prediction(double mutator_time_s,
                               bool this_gc_was_young_only);
   void report_ihop_statistics();
+  // Report the time of the given phase and its prediction for the given units of work
+  // to validate the cost predictions. The prediction includes the fixed cost of the
+  // phase, as the actual time does.
+  void report_cost_prediction(const char* phase, size_t units, double actual_time_ms, double predicted_time_ms) const;
 
   G1Predictions _predictor;
   G1Analytics* _analytics;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1HeapRegion.inline.hpp"
+#include "gc/g1/g1HeapRegionRemSet.inline.hpp"
+#include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1RemSetTrimTask.hpp"
+#include "gc/g1/g1_globals.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+G1RemSetTrimTask::G1RemSetTrimTask(const char* name) :
+  G1ServiceTask(name),
+  _selected(),
+  _selected_at_collection(0) { }
+
+bool G1RemSetTrimTask::should_select_region(G1CollectedHeap* g1h, HeapRegion* r) const {
+  if (r->rem_set()->mem_size() < G1RemSetTrimMinCardSetSize) {
+    return false;
+  }
+  G1Policy* policy = g1h->policy();
+  return policy->predict_region_total_time_ms(r, false /* for_young_only_phase */) > policy->max_pause_time_ms();
+}
+
+void G1RemSetTrimTask::select_regions() {
+  // Block GC pauses so that the candidates and their predictions are stable.
+  SuspendibleThreadSetJoiner sts;
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1CollectionCandidateList& marking_regions = g1h->collection_set()->candidates()->marking_regions();
+  G1Policy* policy = g1h->policy();
+
+  _selected.clear();
+  _selected_at_collection = g1h->total_collections();
+
+  uint num_candidates = marking_regions.length();
+  uint min_old_cset_length = policy->calc_min_old_cset_length(g1h->collection_set()->candidates()->last_marking_candidates_length());
+  if (num_candidates <= min_old_cset_length) {
+    return;
+  }
+
+  // Bound the number of regions selected in the same way as pruning of the
+  // candidates after marking: leave enough regions for the minimum old
+  // collection set length and do not exceed the allowed waste.
+  uint max_to_select = num_candidates - min_old_cset_length;
+  size_t allowed_waste = policy->allowed_waste_in_collection_set();
+  size_t wasted_bytes = 0;
+  size_t trimmed_size = 0;
+
+  // Candidates are sorted by decreasing gc efficiency; collect the least efficient
+  // ones first, and put them in the order of the candidate list afterwards.
+  GrowableArray<HeapRegion*> selected_reversed;
+  for (uint i = num_candidates; i > 0 && (uint)selected_reversed.length() < max_to_select; i--) {
+    HeapRegion* r = marking_regions.at(i - 1)._r;
+    if (!should_select_region(g1h, r)) {
+      continue;
+    }
+    size_t const reclaimable = r->reclaimable_bytes();
+    if (wasted_bytes + reclaimable > allowed_waste) {
+      break;
+    }
+    wasted_bytes += reclaimable;
+    trimmed_size += r->rem_set()->mem_size();
+    selected_reversed.append(r);
+  }
+
+  for (int i = selected_reversed.length() - 1; i >= 0; i--) {
+    _selected.append(selected_reversed.at(i));
+  }
+
+  log_debug(gc, remset)("Selected %u of %u candidate regions for remembered set trimming "
+                        "(remembered set size %zuB, waste %zuB, allowed %zuB)",
+                        _selected.length(), num_candidates, trimmed_size, wasted_bytes, allowed_waste);
+}
+
+void G1RemSetTrimTask::trim_selected_regions(G1CollectionSet* collection_set) {
+  assert_at_safepoint_on_vm_thread();
+
+  if (_selected.length() == 0) {
+    return;
+  }
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1CollectionSetCandidates* candidates = collection_set->candidates();
+  // Any pause since the selection may have changed the candidates.
+  if (_selected_at_collection == g1h->total_collections()) {
+    for (HeapRegion* r : _selected) {
+      assert(candidates->contains(r), "must be candidate region %u", r->hrm_index());
+    }
+    candidates->remove(&_selected);
+
+    for (HeapRegion* r : _selected) {
+      log_trace(gc, remset)("Trimmed remembered set of region %u (%s) size %zuB",
+                            r->hrm_index(), r->get_short_type_str(), r->rem_set()->mem_size());
+      r->rem_set()->clear(true /* only_cardset */);
+    }
+    log_debug(gc, remset)("Trimmed remembered sets of %u candidate regions", _selected.length());
+  }
+  _selected.clear();
+}
+
+void G1RemSetTrimTask::execute() {
+  if (G1RemSetTrimIntervalMillis == 0) {
+    return;
+  }
+  select_regions();
+  schedule(G1RemSetTrimIntervalMillis);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1REMSETTRIMTASK_HPP
+#define SHARE_GC_G1_G1REMSETTRIMTASK_HPP
+
+#include "gc/g1/g1CollectionSetCandidates.hpp"
+#include "gc/g1/g1ServiceThread.hpp"
+
+class G1CollectedHeap;
+class G1CollectionSet;
+
+// Task that concurrently looks for collection set candidate regions that are
+// unlikely to be evacuated in the current mixed phase, i.e. their predicted
+// evacuation time alone exceeds the pause time goal, and whose remembered sets
+// occupy a lot of memory.
+//
+// The selected regions' remembered sets are dropped at the start of the next
+// young collection, which removes them from the candidates. The freed card set
+// memory is returned to the OS by the G1MonotonicArenaFreeMemoryTask. If such a
+// region qualifies again in the next concurrent mark cycle, its remembered set
+// is rebuilt during Rebuild Remembered Sets and Scrub Regions.
+class G1RemSetTrimTask : public G1ServiceTask {
+  G1CollectionCandidateRegionList _selected;
+  // Total number of collections at the time of selection. Selected regions are
+  // only trimmed if no other pause happened since.
+  uint _selected_at_collection;
+
+  bool should_select_region(G1CollectedHeap* g1h, HeapRegion* r) const;
+  void select_regions();
+
+public:
+  explicit G1RemSetTrimTask(const char* name);
+
+  void execute() override;
+
+  // Drop the remembered sets of the regions selected since the last pause and
+  // remove them from the collection set candidates.
+  void trim_selected_regions(G1CollectionSet* collection_set);
+};
+
+#endif // SHARE_GC_G1_G1REMSETTRIMTASK_HPP
@@ -27,6 +27,7 @@
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1GCPauseType.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "jfr/jfrEvents.hpp"
 #if INCLUDE_JFR
@@ -111,6 +112,13 @@ void G1NewTracer::report_basic_ihop_statistics(size_t threshold,
                              last_marking_length);
 }
 
+void G1NewTracer::report_cost_prediction(const char* phase,
+                                         size_t units,
+                                         double predicted_time_ms,
+                                         double actual_time_ms) const {
+  send_cost_prediction(phase, units, predicted_time_ms, actual_time_ms);
+}
+
 void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                                   size_t internal_target_occupancy,
                                                   size_t current_occupancy,
@@ -226,6 +234,22 @@ void G1NewTracer::send_basic_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_cost_prediction(const char* phase,
+                                       size_t units,
+                                       double predicted_time_ms,
+                                       double actual_time_ms) const {
+  EventG1CostPrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_phase(phase);
+    evt.set_units(units);
+    evt.set_predictedTime(predicted_time_ms);
+    evt.set_actualTime(actual_time_ms);
+    evt.set_linearCostModel(G1UseLinearCostModel);
+    evt.commit();
+  }
+}
+
 void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
                                                 size_t internal_target_occupancy,
                                                 size_t current_occupancy,
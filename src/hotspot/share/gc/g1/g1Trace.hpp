@@ -56,6 +56,10 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                     size_t last_allocation_size,
                                     double last_allocation_duration,
                                     double last_marking_length);
+  void report_cost_prediction(const char* phase,
+                              size_t units,
+                              double predicted_time_ms,
+                              double actual_time_ms) const;
   void report_adaptive_ihop_statistics(size_t threshold,
                                        size_t internal_target_occupancy,
                                        size_t current_occupancy,
@@ -77,6 +81,10 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                   size_t last_allocation_size,
                                   double last_allocation_duration,
                                   double last_marking_length);
+  void send_cost_prediction(const char* phase,
+                            size_t units,
+                            double predicted_time_ms,
+                            double actual_time_ms) const;
   void send_adaptive_ihop_statistics(size_t threshold,
                                      size_t internal_target_occupancy,
                                      size_t current_occupancy,
@@ -43,6 +43,7 @@
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionPinCache.inline.hpp"
 #include "gc/g1/g1RemSet.hpp"
+#include "gc/g1/g1RemSetTrimTask.hpp"
 #include "gc/g1/g1RootProcessor.hpp"
 #include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungCollector.hpp"
@@ -280,6 +281,10 @@ void G1YoungCollector::calculate_collection_set(G1EvacInfo* evacuation_info, dou
   // of the collection set!) before finalizing the collection set.
   allocator()->release_mutator_alloc_regions();
 
+  // Drop remembered sets of candidate regions that are unlikely to be collected
+  // before selecting old regions for this collection.
+  _g1h->rem_set_trim_task()->trim_selected_regions(collection_set());
+
   collection_set()->finalize_initial_collection_set(target_pause_time_ms, survivor_regions());
   evacuation_info->set_collection_set_regions(collection_set()->region_length() +
                                               collection_set()->optional_region_length());
@@ -542,9 +547,17 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
   double _start_term;
   double _term_time;
   size_t _term_attempts;
+  // Histogram of termination attempt durations, indexed like the
+  // TerminationAttempts* work items.
+  size_t _term_attempts_by_duration[3];
 
   void start_term_time() { _term_attempts++; _start_term = os::elapsedTime(); }
-  void end_term_time() { _term_time += (os::elapsedTime() - _start_term); }
+  void end_term_time() {
+    double const duration = os::elapsedTime() - _start_term;
+    _term_time += duration;
+    uint const bucket = duration < 0.0001 ? 0 : (duration < 0.001 ? 1 : 2);
+    _term_attempts_by_duration[bucket]++;
+  }
 
   G1CollectedHeap*              _g1h;
   G1ParScanThreadState*         _par_scan_state;
@@ -573,6 +586,7 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
                                 TaskTerminator* terminator,
                                 G1GCPhaseTimes::GCParPhases phase)
     : _start_term(0.0), _term_time(0.0), _term_attempts(0),
+      _term_attempts_by_duration(),
       _g1h(g1h), _par_scan_state(par_scan_state),
       _queues(queues), _terminator(terminator), _phase(phase) {}
 
@@ -590,6 +604,12 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
 
   double term_time() const { return _term_time; }
   size_t term_attempts() const { return _term_attempts; }
+  // Number of attempts in the given duration bucket, index is one of
+  // TerminationAttemptsShort, TerminationAttemptsMedium and TerminationAttemptsLong.
+  size_t term_attempts(G1GCPhaseTimes::GCTerminationWorkItems index) const {
+    assert(index != G1GCPhaseTimes::TerminationAttempts, "use term_attempts()");
+    return _term_attempts_by_duration[index - G1GCPhaseTimes::TerminationAttemptsShort];
+  }
 };
 
 class G1EvacuateRegionsBaseTask : public WorkerTask {
@@ -617,10 +637,18 @@ class G1EvacuateRegionsBaseTask : public WorkerTask {
 
     if (termination_phase == G1GCPhaseTimes::Termination) {
       p->record_time_secs(termination_phase, worker_id, cl.term_time());
-      p->record_thread_work_item(termination_phase, worker_id, cl.term_attempts());
+      p->record_thread_work_item(termination_phase, worker_id, cl.term_attempts(), G1GCPhaseTimes::TerminationAttempts);
+      for (uint i = G1GCPhaseTimes::TerminationAttemptsShort; i <= G1GCPhaseTimes::TerminationAttemptsLong; i++) {
+        G1GCPhaseTimes::GCTerminationWorkItems index = (G1GCPhaseTimes::GCTerminationWorkItems)i;
+        p->record_thread_work_item(termination_phase, worker_id, cl.term_attempts(index), index);
+      }
     } else {
       p->record_or_add_time_secs(termination_phase, worker_id, cl.term_time());
-      p->record_or_add_thread_work_item(termination_phase, worker_id, cl.term_attempts());
+      p->record_or_add_thread_work_item(termination_phase, worker_id, cl.term_attempts(), G1GCPhaseTimes::TerminationAttempts);
+      for (uint i = G1GCPhaseTimes::TerminationAttemptsShort; i <= G1GCPhaseTimes::TerminationAttemptsLong; i++) {
+        G1GCPhaseTimes::GCTerminationWorkItems index = (G1GCPhaseTimes::GCTerminationWorkItems)i;
+        p->record_or_add_thread_work_item(termination_phase, worker_id, cl.term_attempts(index), index);
+      }
     }
     assert(pss->trim_ticks().value() == 0,
            "Unexpected partial trimming during evacuation value " JLONG_FORMAT,
@@ -110,6 +110,11 @@
           "of the optimal occupancy to start marking.")                     \
           range(1, max_intx)                                                \
                                                                             \
+  product(bool, G1UseLinearCostModel, false, EXPERIMENTAL,                  \
+          "Predict the cost of garbage collection phases using a linear "   \
+          "model of fixed cost and cost per unit of work fitted with "      \
+          "online least squares instead of averages of the cost per unit.") \
+                                                                            \
   product(uint, G1ConfidencePercent, 50,                                    \
           "Confidence level for MMU/pause predictions")                     \
           range(0, 100)                                                     \
@@ -316,6 +321,16 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(uint, G1RemSetTrimIntervalMillis, 0, EXPERIMENTAL,                \
+          "Interval in milliseconds at which the service thread looks for " \
+          "collection set candidates with large remembered sets that are "  \
+          "unlikely to be evacuated, whose remembered sets are then "       \
+          "dropped at the next young collection. 0 disables this.")         \
+                                                                            \
+  product(size_t, G1RemSetTrimMinCardSetSize, 1 * M, EXPERIMENTAL,          \
+          "Minimum remembered set memory size in bytes of a collection set "\
+          "candidate region for its remembered set to be trimmed.")         \
+                                                                            \
   product(uint, G1RestoreRetainedRegionChunksPerWorker, 16, DIAGNOSTIC,     \
           "The number of chunks assigned per worker thread for "            \
           "retained region restore purposes.")                              \
@@ -325,6 +340,11 @@
           "After how many GCs a region has been found pinned G1 should "    \
           "give up reclaiming it.")                                         \
                                                                             \
+  product(bool, G1NUMAEvacuateToWorkerNode, false, EXPERIMENTAL,           \
+          "Evacuate surviving objects into survivor regions located on the "\
+          "memory node of the copying GC worker instead of the node of "    \
+          "the source region. Only effective with UseNUMA.")                \
+                                                                            \
   product(uint, G1NumCardsCostSampleThreshold, 1000, DIAGNOSTIC,            \
           "Threshold for the number of cards when reporting remembered set "\
           "card cost related prediction samples. A sample must involve "    \
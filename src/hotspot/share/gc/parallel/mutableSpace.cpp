@@ -39,6 +39,10 @@ MutableSpace::MutableSpace(size_t alignment) :
   _mangler(nullptr),
   _last_setup_region(),
   _alignment(alignment),
+  _numa_stripe_size(0),
+  _numa_stripe_lgrp_ids(nullptr),
+  _numa_stripe_lgrp_num(0),
+  _concurrent_pretouch(false),
   _bottom(nullptr),
   _top(nullptr),
   _end(nullptr)
@@ -50,6 +54,34 @@ MutableSpace::MutableSpace(size_t alignment) :
 
 MutableSpace::~MutableSpace() {
   delete _mangler;
+  FREE_C_HEAP_ARRAY(uint, _numa_stripe_lgrp_ids);
+}
+
+void MutableSpace::set_numa_stripes(size_t stripe_size) {
+  assert(UseNUMA, "Only for NUMA");
+  assert(is_aligned(stripe_size, alignment()), "Stripes must be page aligned");
+  assert(!is_numa_striped(), "Already striped");
+
+  const size_t lgrp_limit = os::numa_get_groups_num();
+  uint* lgrp_ids = NEW_C_HEAP_ARRAY(uint, lgrp_limit, mtGC);
+  const size_t lgrp_num = os::numa_get_leaf_groups(lgrp_ids, lgrp_limit);
+  if (lgrp_num < 2) {
+    // Nothing to stripe across, keep the default placement.
+    FREE_C_HEAP_ARRAY(uint, lgrp_ids);
+    return;
+  }
+
+  _numa_stripe_size = stripe_size;
+  _numa_stripe_lgrp_ids = lgrp_ids;
+  _numa_stripe_lgrp_num = lgrp_num;
+}
+
+int MutableSpace::numa_stripe_lgrp_id(const HeapWord* addr) const {
+  if (!is_numa_striped()) {
+    return -1;
+  }
+  const size_t stripe = (p2i(addr) / _numa_stripe_size) % _numa_stripe_lgrp_num;
+  return (int)_numa_stripe_lgrp_ids[stripe];
 }
 
 void MutableSpace::numa_setup_pages(MemRegion mr, size_t page_size, bool clear_space) {
@@ -62,7 +94,20 @@ void MutableSpace::numa_setup_pages(MemRegion mr, size_t page_size, bool clear_s
         // Prefer page reallocation to migration.
         os::free_memory((char*)start, size, page_size);
       }
-      os::numa_make_global((char*)start, size);
+      if (is_numa_striped()) {
+        // Bind each stripe overlapping the range to its node. The stripe size
+        // is only page aligned, not necessarily a power of two, so compute the
+        // stripe bounds by division like numa_stripe_lgrp_id() does.
+        for (HeapWord* cur = start; cur < end;) {
+          const uintptr_t stripe_start = (p2i(cur) / _numa_stripe_size) * _numa_stripe_size;
+          HeapWord* const stripe_end = MIN2((HeapWord*)(stripe_start + _numa_stripe_size), end);
+          os::numa_make_local((char*)cur, pointer_delta(stripe_end, cur, sizeof(char)),
+                              numa_stripe_lgrp_id(cur));
+          cur = stripe_end;
+        }
+      } else {
+        os::numa_make_global((char*)start, size);
+      }
     }
   }
 }
@@ -119,7 +164,7 @@ void MutableSpace::initialize(MemRegion mr,
       numa_setup_pages(tail, page_size, clear_space);
     }
 
-    if (AlwaysPreTouch) {
+    if (AlwaysPreTouch && !_concurrent_pretouch) {
       size_t pretouch_page_size = UseLargePages ? page_size : os::vm_page_size();
       PretouchTask::pretouch("ParallelGC PreTouch head", (char*)head.start(), (char*)head.end(),
                              pretouch_page_size, pretouch_workers);
@@ -151,6 +196,22 @@ void MutableSpace::clear(bool mangle_space) {
   }
 }
 
+size_t MutableSpace::release_unused_memory() {
+  assert_at_safepoint();
+  // The released range is not mangled again, that would commit it right
+  // away. With ZapUnusedHeapArea keep the words at top and end - 1, which
+  // the mangling checks look at, and let the released range read as zero.
+  HeapWord* const start = align_up(ZapUnusedHeapArea ? top() + 1 : top(), alignment());
+  HeapWord* const end = align_down(ZapUnusedHeapArea ? this->end() - 1 : this->end(), alignment());
+  if (start >= end) {
+    return 0;
+  }
+
+  const size_t size = pointer_delta(end, start, sizeof(char));
+  os::free_memory((char*)start, size, alignment());
+  return size;
+}
+
 #ifndef PRODUCT
 void MutableSpace::check_mangled_unused_area(HeapWord* limit) {
   mangler()->check_mangled_unused_area(limit);
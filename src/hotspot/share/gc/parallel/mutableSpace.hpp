@@ -41,7 +41,9 @@ class WorkerThreads;
 // MutableSpace is also responsible for minimizing the
 // page allocation time by having the memory pretouched (with
 // AlwaysPretouch) and for optimizing page placement on NUMA systems
-// by make the underlying region interleaved (with UseNUMA).
+// by make the underlying region interleaved (with UseNUMA). A space can
+// instead be split into fixed stripes that are bound to the NUMA nodes in
+// round-robin order, see set_numa_stripes().
 //
 // Invariant: bottom() <= top() <= end()
 // top() and end() are exclusive.
@@ -56,6 +58,12 @@ class MutableSpace: public CHeapObj<mtGC> {
   // The last region which page had been setup to be interleaved.
   MemRegion _last_setup_region;
   size_t _alignment;
+  // Striping of the space across the NUMA nodes, zero if interleaved.
+  size_t _numa_stripe_size;
+  uint* _numa_stripe_lgrp_ids;
+  size_t _numa_stripe_lgrp_num;
+  // Leave AlwaysPreTouch of resized parts to the PS service thread.
+  bool _concurrent_pretouch;
   HeapWord* _bottom;
   HeapWord* volatile _top;
   HeapWord* _end;
@@ -85,6 +93,17 @@ class MutableSpace: public CHeapObj<mtGC> {
 
   size_t alignment()                       { return _alignment; }
 
+  void set_concurrent_pretouch(bool value) { _concurrent_pretouch = value; }
+
+  // Bind the pages of the space to the NUMA nodes in stripes of the given
+  // size instead of interleaving them. Stripes are aligned to absolute
+  // addresses, so resizing the space does not change their placement.
+  void set_numa_stripes(size_t stripe_size);
+  bool is_numa_striped() const             { return _numa_stripe_size != 0; }
+  // The lgrp id the stripe containing addr is bound to, or -1 if the space
+  // is not striped.
+  int numa_stripe_lgrp_id(const HeapWord* addr) const;
+
   MemRegion region() const { return MemRegion(bottom(), end()); }
 
   size_t capacity_in_bytes() const { return capacity_in_words() * HeapWordSize; }
@@ -104,6 +123,10 @@ class MutableSpace: public CHeapObj<mtGC> {
                           WorkerThreads* pretouch_workers = nullptr);
 
   virtual void clear(bool mangle_space);
+  // Give the memory backing [top, end) back to the OS. The space stays
+  // committed, the memory is faulted in again on allocation. Returns the
+  // number of bytes released.
+  size_t release_unused_memory();
   virtual void update() { }
   virtual void accumulate_statistics() { }
 
@@ -79,6 +79,12 @@ void ParallelArguments::initialize() {
     }
   }
 
+  if (ParallelUncommitDelay > 0 && UseNUMA) {
+    // Freed eden pages would lose their NUMA placement.
+    log_warning(gc)("ParallelUncommitDelay is not supported with UseNUMA, disabling");
+    FLAG_SET_DEFAULT(ParallelUncommitDelay, 0);
+  }
+
   if (FLAG_IS_DEFAULT(ParallelRefProcEnabled) && ParallelGCThreads > 1) {
     FLAG_SET_DEFAULT(ParallelRefProcEnabled, true);
   }
@@ -33,6 +33,7 @@
 #include "gc/parallel/psParallelCompact.inline.hpp"
 #include "gc/parallel/psPromotionManager.hpp"
 #include "gc/parallel/psScavenge.hpp"
+#include "gc/parallel/psServiceThread.hpp"
 #include "gc/parallel/psVMOperations.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcInitLogger.hpp"
@@ -162,13 +163,13 @@ void ParallelScavengeHeap::initialize_serviceability() {
 }
 
 void ParallelScavengeHeap::safepoint_synchronize_begin() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || _service_thread != nullptr) {
     SuspendibleThreadSet::synchronize();
   }
 }
 
 void ParallelScavengeHeap::safepoint_synchronize_end() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || _service_thread != nullptr) {
     SuspendibleThreadSet::desynchronize();
   }
 }
@@ -188,6 +189,16 @@ void ParallelScavengeHeap::post_initialize() {
   PSPromotionManager::initialize();
 
   ScavengableNMethods::initialize(&_is_scavengable);
+
+  if (PSServiceThread::is_needed()) {
+    _service_thread = new PSServiceThread();
+  }
+}
+
+void ParallelScavengeHeap::stop() {
+  if (_service_thread != nullptr) {
+    _service_thread->stop();
+  }
 }
 
 void ParallelScavengeHeap::update_counters() {
@@ -722,6 +733,9 @@ void ParallelScavengeHeap::print_on_error(outputStream* st) const {
 
 void ParallelScavengeHeap::gc_threads_do(ThreadClosure* tc) const {
   ParallelScavengeHeap::heap()->workers().threads_do(tc);
+  if (_service_thread != nullptr) {
+    tc->do_thread(_service_thread);
+  }
 }
 
 void ParallelScavengeHeap::print_tracing_info() const {
@@ -49,6 +49,7 @@ class MemoryPool;
 class PSAdaptiveSizePolicy;
 class PSCardTable;
 class PSHeapSummary;
+class PSServiceThread;
 
 // ParallelScavengeHeap is the implementation of CollectedHeap for Parallel GC.
 //
@@ -91,6 +92,9 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   WorkerThreads _workers;
 
+  // Only created if needed, see PSServiceThread::is_needed().
+  PSServiceThread* _service_thread;
+
   void initialize_serviceability() override;
 
   void trace_actual_reserved_page_size(const size_t reserved_heap_size, const ReservedSpace rs);
@@ -117,7 +121,8 @@ class ParallelScavengeHeap : public CollectedHeap {
     _eden_pool(nullptr),
     _survivor_pool(nullptr),
     _old_pool(nullptr),
-    _workers("GC Thread", ParallelGCThreads) { }
+    _workers("GC Thread", ParallelGCThreads),
+    _service_thread(nullptr) { }
 
   Name kind() const override {
     return CollectedHeap::Parallel;
@@ -151,8 +156,11 @@ class ParallelScavengeHeap : public CollectedHeap {
   void safepoint_synchronize_end() override;
 
   void post_initialize() override;
+  void stop() override;
   void update_counters();
 
+  PSServiceThread* service_thread() const { return _service_thread; }
+
   size_t capacity() const override;
   size_t used() const override;
 
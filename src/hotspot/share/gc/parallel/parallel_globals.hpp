@@ -45,7 +45,26 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(size_t, ParallelOldNUMAStripeSize, 0, EXPERIMENTAL,               \
+          "With UseNUMA, bind the old generation to the NUMA nodes in "     \
+          "stripes of this size rather than interleaving its pages, and "   \
+          "compact each stripe on a worker running on its node. "           \
+          "0 keeps the interleaved placement")                              \
+          range(0, max_uintx)                                               \
+                                                                            \
+  product(bool, ParallelConcurrentPreTouch, false, EXPERIMENTAL,            \
+          "Pre-touch memory committed by a young generation resize in a "   \
+          "background thread. With AlwaysPreTouch, this moves the "         \
+          "pre-touching of resized young generation memory out of the "     \
+          "pause")                                                          \
+                                                                            \
+  product(uintx, ParallelUncommitDelay, 0, EXPERIMENTAL,                    \
+          "Give the memory backing the unused part of the young "           \
+          "generation back to the OS after no collection has happened for " \
+          "this many milliseconds. 0 disables it")                          \
+          range(0, max_uintx)
 
 // end of GC_PARALLEL_FLAGS
 
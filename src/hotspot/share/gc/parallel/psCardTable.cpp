@@ -160,9 +160,35 @@ class PSStripeShadowCardTable {
     return *card == PSCardTable::clean_card_val();
   }
 
+  // Both searches below compare a word of cards at a time to skip long runs
+  // of clean (respectively dirty) cards, similar to CardTableRS.
+
+  using Word = uintptr_t;
+
+  static constexpr Word ones_in_every_byte = ~Word(0) / 0xff;
+  static constexpr Word high_bit_in_every_byte = ones_in_every_byte << 7;
+
+  // Whether any card in the word is clean, i.e. has all bits set.
+  static bool has_clean_card(Word w) {
+    Word inverted = ~w;
+    return ((inverted - ones_in_every_byte) & ~inverted & high_bit_in_every_byte) != 0;
+  }
+
   const CardValue* find_first_dirty_card(const CardValue* const start,
                                          const CardValue* const end) {
-    for (const CardValue* i = start; i < end; ++i) {
+    const CardValue* i = start;
+    for (/* empty */; i < end && !is_aligned(i, sizeof(Word)); ++i) {
+      if (is_dirty(i)) {
+        return i;
+      }
+    }
+    // Skip words of clean cards.
+    for (/* empty */; i + sizeof(Word) <= end; i += sizeof(Word)) {
+      if (*reinterpret_cast<const Word*>(i) != (Word)CardTable::clean_card_row_val()) {
+        break;
+      }
+    }
+    for (/* empty */; i < end; ++i) {
       if (is_dirty(i)) {
         return i;
       }
@@ -172,7 +198,19 @@ class PSStripeShadowCardTable {
 
   const CardValue* find_first_clean_card(const CardValue* const start,
                                          const CardValue* const end) {
-    for (const CardValue* i = start; i < end; ++i) {
+    const CardValue* i = start;
+    for (/* empty */; i < end && !is_aligned(i, sizeof(Word)); ++i) {
+      if (is_clean(i)) {
+        return i;
+      }
+    }
+    // Skip words of dirty cards.
+    for (/* empty */; i + sizeof(Word) <= end; i += sizeof(Word)) {
+      if (has_clean_card(*reinterpret_cast<const Word*>(i))) {
+        break;
+      }
+    }
+    for (/* empty */; i < end; ++i) {
       if (is_clean(i)) {
         return i;
       }
@@ -62,6 +62,7 @@ ParCompactionManager::ParCompactionManager() {
 
   _deferred_obj_array = new (mtGC) GrowableArray<HeapWord*>(10, mtGC);
   _marking_stats_cache = nullptr;
+  _numa_lgrp_id = -1;
 }
 
 void ParCompactionManager::initialize(ParMarkBitMap* mbm) {
@@ -75,6 +75,9 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   // type of TaskQueue.
   RegionTaskQueue              _region_stack;
 
+  // NUMA node the owning worker last ran marking on, -1 if unknown.
+  int                          _numa_lgrp_id;
+
   GrowableArray<HeapWord*>*    _deferred_obj_array;
 
   static ParMarkBitMap* _mark_bitmap;
@@ -180,6 +183,9 @@ class ParCompactionManager : public CHeapObj<mtGC> {
 
   RegionTaskQueue* region_stack()                { return &_region_stack; }
 
+  int  numa_lgrp_id() const                      { return _numa_lgrp_id; }
+  void set_numa_lgrp_id(int lgrp_id)             { _numa_lgrp_id = lgrp_id; }
+
   // Get the compaction manager when doing evacuation work from the VM thread.
   // Simply use the first compaction manager here.
   static ParCompactionManager* get_vmthread_cm() { return _manager_array[0]; }
@@ -102,6 +102,10 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
   //
 
   _object_space = new MutableSpace(virtual_space()->alignment());
+  if (UseNUMA && ParallelOldNUMAStripeSize > 0) {
+    object_space()->set_numa_stripes(align_up(ParallelOldNUMAStripeSize,
+                                              virtual_space()->alignment()));
+  }
   object_space()->initialize(committed_mr,
                              SpaceDecorator::Clear,
                              SpaceDecorator::Mangle,
@@ -1603,6 +1603,10 @@ class MarkFromRootsTask : public WorkerTask {
   virtual void work(uint worker_id) {
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
     cm->create_marking_stats_cache();
+    if (UseNUMA) {
+      // Remember where this worker runs, see prepare_region_draining_tasks().
+      cm->set_numa_lgrp_id(os::numa_get_group_id());
+    }
     PCMarkAndPushClosure mark_and_push_closure(cm);
 
     {
@@ -1851,6 +1855,18 @@ class FillableRegionLogger : public StackObj {
   }
 };
 
+// Returns the first worker at or after start (cyclically) whose compaction
+// manager last ran on the given node, or start if there is none.
+static uint numa_worker_for(int lgrp_id, uint start, uint parallel_gc_threads) {
+  for (uint i = 0; i < parallel_gc_threads; i++) {
+    const uint worker_id = (start + i) % parallel_gc_threads;
+    if (ParCompactionManager::gc_thread_compaction_manager(worker_id)->numa_lgrp_id() == lgrp_id) {
+      return worker_id;
+    }
+  }
+  return start;
+}
+
 void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 {
   GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
@@ -1861,6 +1877,9 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
   // Find all regions that are available (can be filled immediately) and
   // distribute them to the thread stacks.  The iteration is done in reverse
   // order (high to low) so the regions will be removed in ascending order.
+  // If the space is striped across NUMA nodes, a region goes to a worker on
+  // the node backing it, so the copying into it stays node-local. Stealing
+  // evens out any imbalance this causes.
 
   const ParallelCompactData& sd = PSParallelCompact::summary_data();
 
@@ -1870,6 +1889,7 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
   for (unsigned int id = to_space_id; id + 1 > old_space_id; --id) {
     SpaceInfo* const space_info = _space_info + id;
     HeapWord* const new_top = space_info->new_top();
+    MutableSpace* const space = space_info->space();
 
     const size_t beg_region = sd.addr_to_region_idx(space_info->dense_prefix());
     const size_t end_region =
@@ -1877,7 +1897,12 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 
     for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
       if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+        uint target = worker_id;
+        if (space->is_numa_striped()) {
+          target = numa_worker_for(space->numa_stripe_lgrp_id(sd.region_to_addr(cur)),
+                                   worker_id, parallel_gc_threads);
+        }
+        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(target);
         bool result = sd.region(cur)->mark_normal();
         assert(result, "Must succeed at this point.");
         cm->region_stack()->push(cur);
@@ -31,6 +31,7 @@
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/shared/gcTrace.hpp"
+#include "gc/shared/partialArrayTaskStepper.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "logging/log.hpp"
@@ -288,11 +289,17 @@ void PSPromotionManager::process_array_chunk(PartialArrayScanTask task) {
 
   oop const obj = old->forwardee();
 
+  // The chunk size only depends on the actual length, found in the
+  // to-space copy, so it is the same for all chunks of this array.
+  int const chunk_size =
+    PartialArrayTaskStepper::chunk_size_for(arrayOop(obj)->length(),
+                                            _array_chunk_size,
+                                            ParallelGCThreads);
   int start;
   int const end = arrayOop(old)->length();
-  if (end > (int) _min_array_size_for_chunking) {
+  if (end > 3 * chunk_size / 2) {
     // we'll chunk more
-    start = end - _array_chunk_size;
+    start = end - chunk_size;
     assert(start > 0, "invariant");
     arrayOop(old)->set_length(start);
     push_depth(ScannerTask(PartialArrayScanTask(old)));
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/parallel/psServiceThread.hpp"
+#include "gc/parallel/psVMOperations.hpp"
+#include "gc/parallel/psYoungGen.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/vmThread.hpp"
+
+static const size_t PretouchChunkSize = 1 * M;
+
+static jlong now_ms() {
+  return os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
+}
+
+PSServiceThread::PSServiceThread() :
+    ConcurrentGCThread(),
+    _monitor(Mutex::nosafepoint, "PSServiceThread_lock"),
+    _pretouch_requested(false),
+    _last_gc_count(0),
+    _last_gc_ms(now_ms()),
+    _idle_released(false) {
+  set_name("PS Service");
+  create_and_start();
+}
+
+bool PSServiceThread::is_needed() {
+  return ParallelConcurrentPreTouch || ParallelUncommitDelay > 0;
+}
+
+void PSServiceThread::request_pretouch() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  _pretouch_requested = true;
+  ml.notify();
+}
+
+jlong PSServiceThread::wait_time_ms(jlong now_ms) const {
+  if (ParallelUncommitDelay == 0) {
+    // Wait until pre-touching is requested.
+    return 0;
+  }
+  if (_idle_released) {
+    // Poll for the next collection, which starts a new idle period.
+    return (jlong)ParallelUncommitDelay;
+  }
+  return MAX2(_last_gc_ms + (jlong)ParallelUncommitDelay - now_ms, (jlong)1);
+}
+
+void PSServiceThread::pretouch_young_gen() {
+  // Pauses may resize the young generation, so only look at its bounds
+  // while joined, and look again after every yield.
+  SuspendibleThreadSetJoiner sts;
+  PSVirtualSpace* const vs = ParallelScavengeHeap::young_gen()->virtual_space();
+  const size_t page_size = UseLargePages ? vs->alignment() : os::vm_page_size();
+  // Pre-touch in small chunks, so that a pending safepoint never waits for
+  // more than a few pages to be touched.
+  const size_t chunk_size = MAX2(PretouchChunkSize, page_size);
+
+  log_debug(gc, heap)("Concurrent young generation pre-touch: " SIZE_FORMAT "K",
+                      vs->committed_size() / K);
+
+  char* cur = vs->low();
+  while (!should_terminate()) {
+    cur = MAX2(cur, vs->low());
+    char* const end = MIN2(cur + chunk_size, vs->high());
+    if (cur >= end) {
+      break;
+    }
+    os::pretouch_memory(cur, end, page_size);
+    cur = end;
+
+    if (SuspendibleThreadSet::should_yield()) {
+      SuspendibleThreadSet::yield();
+    }
+  }
+}
+
+void PSServiceThread::release_idle_young_gen(jlong now_ms) {
+  // The count is only read racily here to detect idleness. The operation
+  // checks it again at the safepoint.
+  const uint gc_count = ParallelScavengeHeap::heap()->total_collections();
+  if (gc_count != _last_gc_count) {
+    _last_gc_count = gc_count;
+    _last_gc_ms = now_ms;
+    _idle_released = false;
+    return;
+  }
+
+  if (_idle_released || now_ms - _last_gc_ms < (jlong)ParallelUncommitDelay) {
+    return;
+  }
+
+  VM_ParallelGCReleaseIdleYoung op(gc_count);
+  VMThread::execute(&op);
+  _idle_released = true;
+}
+
+void PSServiceThread::run_service() {
+  _last_gc_count = ParallelScavengeHeap::heap()->total_collections();
+
+  while (!should_terminate()) {
+    bool pretouch;
+    {
+      MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+      if (!_pretouch_requested) {
+        ml.wait(wait_time_ms(now_ms()));
+      }
+      pretouch = _pretouch_requested;
+      _pretouch_requested = false;
+    }
+
+    if (should_terminate()) {
+      break;
+    }
+
+    if (pretouch) {
+      pretouch_young_gen();
+    }
+
+    if (ParallelUncommitDelay > 0) {
+      release_idle_young_gen(now_ms());
+    }
+  }
+}
+
+void PSServiceThread::stop_service() {
+  MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  ml.notify();
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_PARALLEL_PSSERVICETHREAD_HPP
+#define SHARE_GC_PARALLEL_PSSERVICETHREAD_HPP
+
+#include "gc/shared/concurrentGCThread.hpp"
+#include "runtime/mutex.hpp"
+
+// The Parallel GC service thread moves young generation memory maintenance
+// out of the pauses. It pre-touches memory committed by a young generation
+// resize (ParallelConcurrentPreTouch), and gives the memory backing the
+// unused part of the young generation back to the OS once no collection has
+// happened for ParallelUncommitDelay milliseconds.
+class PSServiceThread : public ConcurrentGCThread {
+  Monitor _monitor;
+  bool    _pretouch_requested;
+
+  // Bookkeeping for idle detection, only used by the service thread.
+  uint    _last_gc_count;
+  jlong   _last_gc_ms;
+  bool    _idle_released;
+
+  jlong wait_time_ms(jlong now_ms) const;
+  void pretouch_young_gen();
+  void release_idle_young_gen(jlong now_ms);
+
+protected:
+  void run_service() override;
+  void stop_service() override;
+
+public:
+  PSServiceThread();
+
+  static bool is_needed();
+
+  // Called in a pause after the young generation was expanded.
+  void request_pretouch();
+};
+
+#endif // SHARE_GC_PARALLEL_PSSERVICETHREAD_HPP
@@ -76,3 +76,15 @@ void VM_ParallelGCSystemGC::doit() {
     _full_gc_succeeded = PSParallelCompact::invoke(false);
   }
 }
+
+void VM_ParallelGCReleaseIdleYoung::doit() {
+  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
+  if (heap->total_collections() != _gc_count) {
+    // A collection happened since the request, the heap is not idle.
+    return;
+  }
+
+  const size_t released = heap->young_gen()->release_unused_memory();
+  log_info(gc, heap)("Released " SIZE_FORMAT "K of unused young generation memory after "
+                     UINTX_FORMAT "ms without collection", released / K, ParallelUncommitDelay);
+}
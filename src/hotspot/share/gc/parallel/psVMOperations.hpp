@@ -48,4 +48,14 @@ class VM_ParallelGCSystemGC: public VM_GC_Operation {
   bool full_gc_succeeded() const { return _full_gc_succeeded; }
 };
 
+// Releases the memory backing the unused young generation, requested by the
+// PS service thread after the heap has been idle for ParallelUncommitDelay.
+class VM_ParallelGCReleaseIdleYoung : public VM_Operation {
+  uint _gc_count;
+ public:
+  VM_ParallelGCReleaseIdleYoung(uint gc_count) : _gc_count(gc_count) { }
+  virtual VMOp_Type type() const { return VMOp_ParallelGCReleaseIdleYoung; }
+  virtual void doit();
+};
+
 #endif // SHARE_GC_PARALLEL_PSVMOPERATIONS_HPP
@@ -26,6 +26,7 @@
 #include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/psScavenge.hpp"
+#include "gc/parallel/psServiceThread.hpp"
 #include "gc/parallel/psYoungGen.hpp"
 #include "gc/shared/gcUtil.hpp"
 #include "gc/shared/genArguments.hpp"
@@ -193,6 +194,20 @@ void PSYoungGen::set_space_boundaries(size_t eden_size, size_t survivor_size) {
   eden_space()->initialize(eden_mr, true, ZapUnusedHeapArea, MutableSpace::SetupPages, &pretouch_workers);
     to_space()->initialize(to_mr  , true, ZapUnusedHeapArea, MutableSpace::SetupPages, &pretouch_workers);
   from_space()->initialize(from_mr, true, ZapUnusedHeapArea, MutableSpace::SetupPages, &pretouch_workers);
+
+  if (ParallelConcurrentPreTouch) {
+    // Pre-touch after later resizes is done by the PS service thread.
+    eden_space()->set_concurrent_pretouch(true);
+      to_space()->set_concurrent_pretouch(true);
+    from_space()->set_concurrent_pretouch(true);
+  }
+}
+
+size_t PSYoungGen::release_unused_memory() {
+  assert(!UseNUMA, "MutableNUMASpace manages the placement of eden pages itself");
+  return eden_space()->release_unused_memory() +
+         from_space()->release_unused_memory() +
+         to_space()->release_unused_memory();
 }
 
 #ifndef PRODUCT
@@ -249,10 +264,15 @@ void PSYoungGen::space_invariants() {
 void PSYoungGen::resize(size_t eden_size, size_t survivor_size) {
   // Resize the generation if needed. If the generation resize
   // reports false, do not attempt to resize the spaces.
+  const size_t orig_committed = virtual_space()->committed_size();
   if (resize_generation(eden_size, survivor_size)) {
     // Then we lay out the spaces inside the generation
     resize_spaces(eden_size, survivor_size);
 
+    if (ParallelConcurrentPreTouch && virtual_space()->committed_size() > orig_committed) {
+      ParallelScavengeHeap::heap()->service_thread()->request_pretouch();
+    }
+
     space_invariants();
 
     log_trace(gc, ergo)("Young generation size: "
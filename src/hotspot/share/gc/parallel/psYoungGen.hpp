@@ -134,6 +134,10 @@ class PSYoungGen : public CHeapObj<mtGC> {
 
   void reset_survivors_after_shrink();
 
+  // Release the memory backing the unused parts of eden and the survivor
+  // spaces, see MutableSpace::release_unused_memory().
+  size_t release_unused_memory();
+
   // Performance Counter support
   void update_counters();
 
@@ -85,6 +85,12 @@ void ClassUnloadingContext::purge_class_loader_data() {
   }
 }
 
+ClassLoaderData* ClassUnloadingContext::release_class_loader_data() {
+  ClassLoaderData* head = _cld_head;
+  _cld_head = nullptr;
+  return head;
+}
+
 void ClassUnloadingContext::classes_unloading_do(void f(Klass* const)) {
   assert_locked_or_safepoint(ClassLoaderDataGraph_lock);
   for (ClassLoaderData* cld = _cld_head; cld != nullptr; cld = cld->unloading_next()) {
@@ -65,6 +65,9 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
 
   void register_unloading_class_loader_data(ClassLoaderData* cld);
   void purge_class_loader_data();
+  // Hands the unloaded CLDs, linked through unloading_next(), over to the
+  // caller, which becomes responsible for deleting them.
+  ClassLoaderData* release_class_loader_data();
 
   void classes_unloading_do(void f(Klass* const));
 
@@ -144,6 +144,17 @@
           "number of GC threads")                                           \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
                                                                             \
+  product(bool, UseGCWorkerCountFeedback, false, EXPERIMENTAL,              \
+          "Limit the number of workers used for a parallel GC phase based " \
+          "on the parallel efficiency measured for earlier executions of "  \
+          "that phase")                                                     \
+                                                                            \
+  product(uint, GCWorkerMinParallelEfficiency, 50, EXPERIMENTAL,            \
+          "With UseGCWorkerCountFeedback, the percentage of the available " \
+          "worker time a phase must spend working for its number of "       \
+          "workers not to be reduced")                                      \
+          range(1, 100)                                                     \
+                                                                            \
   product(uint, ConcGCThreads, 0,                                           \
           "Number of threads concurrent gc will use")                       \
                                                                             \
@@ -183,11 +194,24 @@
   product(bool, ResizePLAB, true,                                           \
           "Dynamically resize (survivor space) promotion LAB's")            \
                                                                             \
+  product(bool, ResizePLABPerWorker, false, EXPERIMENTAL,                   \
+          "With ResizePLAB, size the PLABs of each GC worker from what "    \
+          "that worker copied in recent collections, instead of using a "   \
+          "single size for all workers")                                    \
+                                                                            \
+  product(bool, SATBBufferFilterDuplicates, false, EXPERIMENTAL,            \
+          "When filtering a full SATB buffer, also remove entries that "    \
+          "were recently seen in the same buffer")                          \
+                                                                            \
   product(int, ParGCArrayScanChunk, 50,                                     \
           "Scan a subset of object array and push remainder, if array is "  \
           "bigger than this")                                               \
           range(1, INT_MAX/3)                                               \
                                                                             \
+  product(bool, UseAdaptivePartialArrayChunkSize, false, EXPERIMENTAL,      \
+          "Scale the chunk size used to process large object arrays in "    \
+          "parallel by the array length and the number of GC workers, "     \
+          "using ParGCArrayScanChunk as the minimum")                       \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -215,6 +239,10 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, RefProcMergePhantomRefsPhase, true, DIAGNOSTIC,             \
+          "Process PhantomReferences in the same parallel pass as "         \
+          "Soft- and WeakReferences if no FinalReferences were discovered") \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -268,6 +296,16 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(bool, UseAdaptiveTaskTermination, false, EXPERIMENTAL,            \
+          "Adapt the number of spin and yield steps performed before "      \
+          "sleeping during termination to whether spinning recently "       \
+          "found work, and sleep early if there are more GC threads than "  \
+          "active processors")                                              \
+                                                                            \
+  product(bool, UseNUMATaskStealing, false, EXPERIMENTAL,                   \
+          "Prefer stealing from task queues of workers running on the "     \
+          "same NUMA node before trying any queue. Requires UseNUMA")       \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -546,6 +584,11 @@
           "Soft limit for maximum heap size (in bytes)")                    \
           constraint(SoftMaxHeapSizeConstraintFunc,AfterMemoryInit)         \
                                                                             \
+  product(bool, SoftMaxHeapSizeFollowsMemoryLimit, false, EXPERIMENTAL,     \
+          "Recompute SoftMaxHeapSize from MaxRAMPercentage whenever the "   \
+          "physical memory limit changes, e.g. when a container's memory "  \
+          "limit is resized in place")                                      \
+                                                                            \
   product(size_t, OldSize, ScaleForWordSize(4*M),                           \
           "Initial tenured generation size (in bytes)")                     \
           range(0, max_uintx)                                               \
@@ -130,7 +130,7 @@ OopStorage::ActiveArray* OopStorage::ActiveArray::create(size_t size,
                                                          MEMFLAGS memflags,
                                                          AllocFailType alloc_fail) {
   size_t size_in_bytes = blocks_offset() + sizeof(Block*) * size;
-  void* mem = NEW_C_HEAP_ARRAY3(char, size_in_bytes, memflags, CURRENT_PC, alloc_fail);
+  void* mem = NEW_C_HEAP_ARRAY3(char, size_in_bytes, memflags, MALLOC_CURRENT_PC, alloc_fail);
   if (mem == nullptr) return nullptr;
   return new (mem) ActiveArray(size);
 }
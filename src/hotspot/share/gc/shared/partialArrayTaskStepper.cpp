@@ -23,8 +23,10 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/partialArrayTaskStepper.hpp"
 #include "oops/arrayOop.hpp"
+#include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -52,3 +54,24 @@ PartialArrayTaskStepper::PartialArrayTaskStepper(uint n_workers) :
   _task_limit(compute_task_limit(n_workers)),
   _task_fanout(compute_task_fanout(_task_limit))
 {}
+
+int PartialArrayTaskStepper::chunk_size_for(int length,
+                                            int min_chunk_size,
+                                            uint n_workers) {
+  assert(min_chunk_size > 0, "precondition");
+  if (!UseAdaptivePartialArrayChunkSize) {
+    return min_chunk_size;
+  }
+  // Give each worker a number of chunks, so that stealing can still even
+  // out differences in the cost of processing individual chunks.
+  const size_t chunks_per_worker = 16;
+  size_t target_chunks = MAX2(n_workers, 1u) * chunks_per_worker;
+  size_t chunk_size = static_cast<size_t>(length) / target_chunks;
+  if (chunk_size <= static_cast<size_t>(min_chunk_size)) {
+    return min_chunk_size;
+  }
+  // Use whole cache lines worth of elements, so chunks claimed by different
+  // workers share at most one cache line.
+  chunk_size = align_up(chunk_size, DEFAULT_CACHE_LINE_SIZE / heapOopSize);
+  return static_cast<int>(MIN2(chunk_size, static_cast<size_t>(length)));
+}
@@ -63,6 +63,18 @@ class PartialArrayTaskStepper {
   // precondition: chunk_size must be the same as used to start the task sequence.
   inline Step next(arrayOop from, arrayOop to, int chunk_size) const;
 
+  // Returns the chunk size to use for an array of the given length, which
+  // is at least min_chunk_size.  With UseAdaptivePartialArrayChunkSize,
+  // huge arrays are split into a bounded number of chunks per worker,
+  // rather than into a huge number of min_chunk_size chunks, each of which
+  // needs a claim and a task queue round trip.  The result only depends on
+  // the arguments, so all tasks for an array agree on the chunk size.
+  static int chunk_size_for(int length, int min_chunk_size, uint n_workers);
+
+  int chunk_size(int length, int min_chunk_size) const {
+    return chunk_size_for(length, min_chunk_size, _task_limit);
+  }
+
   class TestSupport;            // For unit tests
 
 private:
@@ -121,3 +121,36 @@ void PLAB::undo_allocation(HeapWord* obj, size_t word_sz) {
     add_undo_waste(obj, word_sz);
   }
 }
+
+PLABWorkerSizing::PLABWorkerSizing(uint max_workers, unsigned wt, uint last_plab_occupancy) :
+  _max_workers(max_workers),
+  _last_plab_occupancy(last_plab_occupancy),
+  _used(NEW_C_HEAP_ARRAY(AdaptiveWeightedAverage, max_workers, mtGC)) {
+  assert(last_plab_occupancy < 100, "must be");
+  for (uint i = 0; i < _max_workers; i++) {
+    ::new (&_used[i]) AdaptiveWeightedAverage(wt);
+  }
+}
+
+PLABWorkerSizing::~PLABWorkerSizing() {
+  FREE_C_HEAP_ARRAY(AdaptiveWeightedAverage, _used);
+}
+
+void PLABWorkerSizing::record(uint worker_id, size_t used) {
+  if (worker_id < _max_workers) {
+    _used[worker_id].sample((float)used);
+  }
+}
+
+size_t PLABWorkerSizing::desired_plab_size(uint worker_id) const {
+  if (worker_id >= _max_workers || _used[worker_id].count() == 0) {
+    return 0;
+  }
+  // Allow the worker to waste TargetPLABWastePct of what it uses, given that
+  // its last buffer is expected to be _last_plab_occupancy full. See
+  // G1EvacStats::compute_desired_plab_size() for the same calculation over
+  // all workers.
+  const double waste_allowed = _used[worker_id].average() * TargetPLABWastePct;
+  const size_t desired = (size_t)(waste_allowed / (100 - _last_plab_occupancy));
+  return align_object_size(clamp(desired, PLAB::min_size(), PLAB::max_size()));
+}
@@ -26,6 +26,7 @@
 #define SHARE_GC_SHARED_PLAB_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcUtil.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -104,6 +105,8 @@ class PLAB: public CHeapObj<mtGC> {
   size_t word_sz() { return _word_sz; }
 
   size_t waste() { return _wasted; }
+  // Words allocated to objects so far, including undone allocations.
+  size_t used() const { return _allocated - _wasted - pointer_delta(_hard_end, _top); }
   size_t undo_waste() { return _undo_wasted; }
 
   // The number of words of unallocated space remaining in the buffer.
@@ -195,4 +198,27 @@ class PLABStats : public CHeapObj<mtGC> {
   inline void add_undo_wasted(size_t v);
 };
 
+// Per-worker PLAB sizing. A single desired PLAB size serves workers that
+// copy very different amounts badly: the busy ones refill often, the idle
+// ones waste most of their last buffer. This keeps a decaying average of the
+// words each worker used in its PLABs per GC, and derives the worker's own
+// desired size from it with the same waste target as the shared sizing.
+class PLABWorkerSizing : public CHeapObj<mtGC> {
+  const uint _max_workers;
+  // Expected occupancy of the last PLAB of a worker in percent.
+  const uint _last_plab_occupancy;
+  AdaptiveWeightedAverage* _used;
+
+public:
+  PLABWorkerSizing(uint max_workers, unsigned wt, uint last_plab_occupancy);
+  ~PLABWorkerSizing();
+
+  // Record the words used in PLABs by the given worker during the last GC.
+  void record(uint worker_id, size_t used);
+
+  // The desired PLAB size for the given worker, or 0 if there is no
+  // history for it yet.
+  size_t desired_plab_size(uint worker_id) const;
+};
+
 #endif // SHARE_GC_SHARED_PLAB_HPP
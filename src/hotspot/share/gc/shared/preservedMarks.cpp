@@ -32,11 +32,19 @@
 #include "runtime/atomic.hpp"
 #include "utilities/macros.hpp"
 
+size_t PreservedMarks::element_size() {
+  return UseCompressedOops ? sizeof(CompactPreservedMark) : sizeof(PreservedMark);
+}
+
 void PreservedMarks::restore() {
   while (!_stack.is_empty()) {
     const PreservedMark elem = _stack.pop();
     elem.set_mark();
   }
+  while (!_compact_stack.is_empty()) {
+    const CompactPreservedMark elem = _compact_stack.pop();
+    elem.set_mark();
+  }
   assert_empty();
 }
 
@@ -47,12 +55,24 @@ void PreservedMarks::adjust_preserved_mark(PreservedMark* elem) {
   }
 }
 
+void PreservedMarks::adjust_preserved_mark(CompactPreservedMark* elem) {
+  oop obj = elem->get_oop();
+  if (obj->is_forwarded()) {
+    elem->set_oop(obj->forwardee());
+  }
+}
+
 void PreservedMarks::adjust_during_full_gc() {
   StackIterator<PreservedMark, mtGC> iter(_stack);
   while (!iter.is_empty()) {
     PreservedMark* elem = iter.next_addr();
     adjust_preserved_mark(elem);
   }
+  StackIterator<CompactPreservedMark, mtGC> compact_iter(_compact_stack);
+  while (!compact_iter.is_empty()) {
+    CompactPreservedMark* elem = compact_iter.next_addr();
+    adjust_preserved_mark(elem);
+  }
 }
 
 void PreservedMarks::restore_and_increment(volatile size_t* const total_size_addr) {
@@ -71,6 +91,11 @@ void PreservedMarks::assert_empty() {
   assert(_stack.cache_size() == 0,
          "stack expected to have no cached segments, cache size = " SIZE_FORMAT,
          _stack.cache_size());
+  assert(_compact_stack.is_empty(), "compact stack expected to be empty, size = " SIZE_FORMAT,
+         _compact_stack.size());
+  assert(_compact_stack.cache_size() == 0,
+         "compact stack expected to have no cached segments, cache size = " SIZE_FORMAT,
+         _compact_stack.cache_size());
 }
 #endif // ndef PRODUCT
 
@@ -122,7 +147,7 @@ class RestorePreservedMarksTask : public WorkerTask {
 
   ~RestorePreservedMarksTask() {
     assert(_total_size == _total_size_before, "total_size = %zu before = %zu", _total_size, _total_size_before);
-    size_t mem_size = _total_size * (sizeof(oop) + sizeof(markWord));
+    size_t mem_size = _total_size * PreservedMarks::element_size();
     log_trace(gc)("Restored %zu marks, occupying %zu %s", _total_size,
                                                           byte_size_in_proper_unit(mem_size),
                                                           proper_unit_for_byte_size(mem_size));
@@ -47,16 +47,40 @@ class PreservedMark {
   void set_oop(oop obj) { _o = obj; }
 };
 
+// A PreservedMark using a compressed oop, used with UseCompressedOops to
+// reduce the memory needed when many marks have to be preserved.
+// The mark word is split up so the element is only 4-byte aligned, making
+// it 12 instead of 16 bytes.
+class CompactPreservedMark {
+ private:
+  narrowOop _o;
+  uint32_t _m_lo;
+  uint32_t _m_hi;
+
+ public:
+  inline CompactPreservedMark(oop obj, markWord m);
+
+  inline oop get_oop() const;
+  inline void set_mark() const;
+  inline void set_oop(oop obj);
+};
+
 class PreservedMarks {
 private:
   typedef Stack<PreservedMark, mtGC> PreservedMarkStack;
+  typedef Stack<CompactPreservedMark, mtGC> CompactPreservedMarkStack;
 
+  // Marks of objects whose oop can be compressed go on _compact_stack.
   PreservedMarkStack _stack;
+  CompactPreservedMarkStack _compact_stack;
 
   inline bool should_preserve_mark(oop obj, markWord m) const;
+  inline void push(oop obj, markWord m);
 
 public:
-  size_t size() const { return _stack.size(); }
+  size_t size() const { return _stack.size() + _compact_stack.size(); }
+  // The size of a preserved mark entry, in bytes.
+  static size_t element_size();
   inline void push_if_necessary(oop obj, markWord m);
   inline void push_always(oop obj, markWord m);
   // Iterate over the stack, restore all preserved marks, and
@@ -66,6 +90,7 @@ class PreservedMarks {
   // Adjust the preserved mark according to its
   // forwarding location stored in the mark.
   static void adjust_preserved_mark(PreservedMark* elem);
+  static void adjust_preserved_mark(CompactPreservedMark* elem);
 
   // Iterate over the stack, adjust all preserved marks according
   // to their forwarding location stored in the mark.
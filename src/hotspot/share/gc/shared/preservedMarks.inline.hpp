@@ -28,6 +28,7 @@
 #include "gc/shared/preservedMarks.hpp"
 
 #include "logging/log.hpp"
+#include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "utilities/stack.inline.hpp"
 
@@ -35,17 +36,27 @@ inline bool PreservedMarks::should_preserve_mark(oop obj, markWord m) const {
   return obj->mark_must_be_preserved(m);
 }
 
-inline void PreservedMarks::push_if_necessary(oop obj, markWord m) {
-  if (should_preserve_mark(obj, m)) {
+inline void PreservedMarks::push(oop obj, markWord m) {
+  // Objects outside the compressed oop range, e.g. fake objects in unit
+  // tests, use full entries.
+  if (UseCompressedOops && CompressedOops::is_in(obj)) {
+    CompactPreservedMark elem(obj, m);
+    _compact_stack.push(elem);
+  } else {
     PreservedMark elem(obj, m);
     _stack.push(elem);
   }
 }
 
+inline void PreservedMarks::push_if_necessary(oop obj, markWord m) {
+  if (should_preserve_mark(obj, m)) {
+    push(obj, m);
+  }
+}
+
 inline void PreservedMarks::push_always(oop obj, markWord m) {
   assert(!m.is_marked(), "precondition");
-  PreservedMark elem(obj, m);
-  _stack.push(elem);
+  push(obj, m);
 }
 
 inline PreservedMarks::PreservedMarks()
@@ -54,10 +65,30 @@ inline PreservedMarks::PreservedMarks()
              // no point in caching stack segments (there will be a
              // waste of space most of the time). So we set the max
              // cache size to 0.
-             0 /* max_cache_size */) { }
+             0 /* max_cache_size */),
+      _compact_stack(CompactPreservedMarkStack::default_segment_size(),
+                     0 /* max_cache_size */) { }
 
 void PreservedMark::set_mark() const {
   _o->set_mark(_m);
 }
 
+inline CompactPreservedMark::CompactPreservedMark(oop obj, markWord m) :
+  _o(CompressedOops::encode_not_null(obj)),
+  _m_lo((uint32_t)m.value()),
+  _m_hi((uint32_t)((uint64_t)m.value() >> 32)) { }
+
+inline oop CompactPreservedMark::get_oop() const {
+  return CompressedOops::decode_not_null(_o);
+}
+
+inline void CompactPreservedMark::set_mark() const {
+  uint64_t value = ((uint64_t)_m_hi << 32) | _m_lo;
+  get_oop()->set_mark(markWord((uintptr_t)value));
+}
+
+inline void CompactPreservedMark::set_oop(oop obj) {
+  _o = CompressedOops::encode_not_null(obj);
+}
+
 #endif // SHARE_GC_SHARED_PRESERVEDMARKS_INLINE_HPP
@@ -40,7 +40,10 @@ PretouchTask::PretouchTask(const char* task_name,
     _cur_addr(start_address),
     _end_addr(end_address),
     _page_size(page_size),
-    _chunk_size(chunk_size) {
+    _chunk_size(chunk_size),
+    _total_bytes(pointer_delta(end_address, start_address, sizeof(char))),
+    _touched_bytes(0),
+    _start_time(Ticks::now()) {
 
   assert(chunk_size >= page_size,
          "Chunk size " SIZE_FORMAT " is smaller than page size " SIZE_FORMAT,
@@ -59,10 +62,32 @@ void PretouchTask::work(uint worker_id) {
       break;
     } else if (cur_start == Atomic::cmpxchg(&_cur_addr, cur_start, cur_end)) {
       os::pretouch_memory(cur_start, cur_end, _page_size);
+      report_progress(pointer_delta(cur_end, cur_start, sizeof(char)));
     } // Else attempt to claim chunk failed, so try again.
   }
 }
 
+void PretouchTask::report_progress(size_t touched_bytes) {
+  // Pretouching a large heap can take a long time, so report every 10%
+  // of the range.  Only the worker completing the chunk that crosses a 10%
+  // boundary logs, so each step is reported once.
+  if (!log_is_enabled(Info, gc, heap, pretouch)) {
+    return;
+  }
+  size_t prev_bytes = Atomic::fetch_then_add(&_touched_bytes, touched_bytes);
+  size_t cur_bytes = prev_bytes + touched_bytes;
+  uint prev_percent = (uint)(prev_bytes * 10 / _total_bytes) * 10;
+  uint cur_percent = (uint)(cur_bytes * 10 / _total_bytes) * 10;
+  if (prev_percent != cur_percent) {
+    double secs = (Ticks::now() - _start_time).seconds();
+    log_info(gc, heap, pretouch)("%s: %u%% (" SIZE_FORMAT "%s of " SIZE_FORMAT "%s) in %.3fs",
+                                 name(), cur_percent,
+                                 byte_size_in_proper_unit(cur_bytes), proper_unit_for_byte_size(cur_bytes),
+                                 byte_size_in_proper_unit(_total_bytes), proper_unit_for_byte_size(_total_bytes),
+                                 secs);
+  }
+}
+
 void PretouchTask::pretouch(const char* task_name, char* start_address, char* end_address,
                             size_t page_size, WorkerThreads* pretouch_workers) {
   // Page-align the chunk size, so if start_address is also page-aligned (as
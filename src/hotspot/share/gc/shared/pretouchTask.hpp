@@ -26,6 +26,7 @@
 #define SHARE_GC_SHARED_PRETOUCH_HPP
 
 #include "gc/shared/workerThread.hpp"
+#include "utilities/ticks.hpp"
 
 class PretouchTask : public WorkerTask {
   char* volatile _cur_addr;
@@ -33,6 +34,13 @@ class PretouchTask : public WorkerTask {
   size_t _page_size;
   size_t _chunk_size;
 
+  // Progress reporting, see report_progress().
+  const size_t _total_bytes;
+  volatile size_t _touched_bytes;
+  const Ticks _start_time;
+
+  void report_progress(size_t touched_bytes);
+
 public:
   PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size, size_t chunk_size);
 
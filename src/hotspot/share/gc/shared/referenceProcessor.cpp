@@ -196,9 +196,12 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
 
   phase_times.set_processing_is_mt(processing_is_mt());
 
+  bool const merge_phantom_refs = can_merge_phantom_refs(phase_times);
+  phase_times.set_phantom_refs_merged(merge_phantom_refs);
+
   {
     RefProcTotalPhaseTimesTracker tt(SoftWeakFinalRefsPhase, &phase_times);
-    process_soft_weak_final_refs(proxy_task, phase_times);
+    process_soft_weak_final_refs(proxy_task, phase_times, merge_phantom_refs);
   }
 
   {
@@ -206,7 +209,7 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
     process_final_keep_alive(proxy_task, phase_times);
   }
 
-  {
+  if (!merge_phantom_refs) {
     RefProcTotalPhaseTimesTracker tt(PhantomRefsPhase, &phase_times);
     process_phantom_refs(proxy_task, phase_times);
   }
@@ -483,11 +486,15 @@ void RefProcTask::process_discovered_list(uint worker_id,
 }
 
 class RefProcSoftWeakFinalPhaseTask: public RefProcTask {
+  bool const _include_phantom_refs;
+
 public:
   RefProcSoftWeakFinalPhaseTask(ReferenceProcessor& ref_processor,
-                                ReferenceProcessorPhaseTimes* phase_times)
+                                ReferenceProcessorPhaseTimes* phase_times,
+                                bool include_phantom_refs)
     : RefProcTask(ref_processor,
-                  phase_times) {}
+                  phase_times),
+      _include_phantom_refs(include_phantom_refs) {}
 
   void rp_work(uint worker_id,
                BoolObjectClosure* is_alive,
@@ -502,6 +509,10 @@ class RefProcSoftWeakFinalPhaseTask: public RefProcTask {
 
     process_discovered_list(worker_id, REF_FINAL, is_alive, keep_alive, enqueue);
 
+    if (_include_phantom_refs) {
+      process_discovered_list(worker_id, REF_PHANTOM, is_alive, keep_alive, enqueue);
+    }
+
     // Close the reachable set; needed for collectors which keep_alive_closure do
     // not immediately complete their work.
     complete_gc->do_void();
@@ -721,13 +732,21 @@ void ReferenceProcessor::run_task(RefProcTask& task, RefProcProxyTask& proxy_tas
   }
 }
 
+bool ReferenceProcessor::can_merge_phantom_refs(ReferenceProcessorPhaseTimes& phase_times) const {
+  return RefProcMergePhantomRefsPhase &&
+         phase_times.ref_discovered(REF_FINAL) == 0 &&
+         phase_times.ref_discovered(REF_PHANTOM) != 0;
+}
+
 void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_task,
-                                                      ReferenceProcessorPhaseTimes& phase_times) {
+                                                      ReferenceProcessorPhaseTimes& phase_times,
+                                                      bool include_phantom_refs) {
 
   size_t const num_soft_refs = phase_times.ref_discovered(REF_SOFT);
   size_t const num_weak_refs = phase_times.ref_discovered(REF_WEAK);
   size_t const num_final_refs = phase_times.ref_discovered(REF_FINAL);
-  size_t const num_total_refs = num_soft_refs + num_weak_refs + num_final_refs;
+  size_t const num_phantom_refs = include_phantom_refs ? phase_times.ref_discovered(REF_PHANTOM) : 0;
+  size_t const num_total_refs = num_soft_refs + num_weak_refs + num_final_refs + num_phantom_refs;
 
   if (num_total_refs == 0) {
     log_debug(gc, ref)("Skipped SoftWeakFinalRefsPhase of Reference Processing: no references");
@@ -741,17 +760,26 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
     maybe_balance_queues(_discoveredSoftRefs);
     maybe_balance_queues(_discoveredWeakRefs);
     maybe_balance_queues(_discoveredFinalRefs);
+    if (include_phantom_refs) {
+      maybe_balance_queues(_discoveredPhantomRefs);
+    }
   }
 
   log_reflist("SoftWeakFinalRefsPhase Soft before", _discoveredSoftRefs, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Weak before", _discoveredWeakRefs, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Final before", _discoveredFinalRefs, _max_num_queues);
+  if (include_phantom_refs) {
+    log_reflist("SoftWeakFinalRefsPhase Phantom before", _discoveredPhantomRefs, _max_num_queues);
+  }
 
-  RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times);
+  RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times, include_phantom_refs);
   run_task(phase_task, proxy_task, false);
 
   verify_total_count_zero(_discoveredSoftRefs, "SoftReference");
   verify_total_count_zero(_discoveredWeakRefs, "WeakReference");
+  if (include_phantom_refs) {
+    verify_total_count_zero(_discoveredPhantomRefs, "PhantomReference");
+  }
   log_reflist("SoftWeakFinalRefsPhase Final after", _discoveredFinalRefs, _max_num_queues);
 }
 
@@ -256,9 +256,17 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   void run_task(RefProcTask& task, RefProcProxyTask& proxy_task, bool marks_oops_alive);
 
   // Drop Soft/Weak/Final references with a null or live referent, and clear
-  // and enqueue non-Final references.
+  // and enqueue non-Final references. If include_phantom_refs is set, Phantom
+  // references are processed in the same pass.
   void process_soft_weak_final_refs(RefProcProxyTask& proxy_task,
-                                    ReferenceProcessorPhaseTimes& phase_times);
+                                    ReferenceProcessorPhaseTimes& phase_times,
+                                    bool include_phantom_refs);
+
+  // Whether Phantom references can be processed together with Soft/Weak/Final
+  // references. This is the case if there are no Final references, since
+  // only keeping alive their referents can change the reachability of the
+  // referents of Phantom references.
+  bool can_merge_phantom_refs(ReferenceProcessorPhaseTimes& phase_times) const;
 
   // Keep alive followers of Final references, and enqueue.
   void process_final_keep_alive(RefProcProxyTask& proxy_task,
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_SATBMARKQUEUE_HPP
 #define SHARE_GC_SHARED_SATBMARKQUEUE_HPP
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/ptrQueue.hpp"
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
@@ -98,6 +99,9 @@ class SATBMarkQueueSet: public PtrQueueSet {
   BufferNode* get_completed_buffer();
   void abandon_completed_buffers();
 
+  template<typename Filter>
+  void apply_filter_impl(Filter filter, SATBMarkQueue& queue);
+
 #ifdef ASSERT
   void dump_active_states(bool expected_active);
   void verify_active_states(bool expected_active);
@@ -165,6 +169,33 @@ class SATBMarkQueueSet: public PtrQueueSet {
   void abandon_partial_marking();
 };
 
+// A small direct-mapped cache of recently seen SATB entries, used to drop
+// repeated entries for the same object from a buffer with
+// SATBBufferFilterDuplicates.  Mutators often overwrite the same fields
+// repeatedly, logging the same previous values, and entries for objects
+// that are not yet marked survive the regular filtering.
+class SATBRecentEntries : public StackObj {
+  static const size_t Size = 32;
+  void* _entries[Size];
+
+public:
+  SATBRecentEntries() {
+    for (size_t i = 0; i < Size; ++i) {
+      _entries[i] = nullptr;
+    }
+  }
+
+  // Returns true if entry was seen recently, otherwise records it.
+  bool check_and_record(void* entry) {
+    size_t i = (reinterpret_cast<uintptr_t>(entry) >> LogMinObjAlignmentInBytes) % Size;
+    if (_entries[i] == entry) {
+      return true;
+    }
+    _entries[i] = entry;
+    return false;
+  }
+};
+
 // Removes entries from queue's buffer that are no longer needed, as
 // determined by filter. If e is a void* entry in queue's buffer,
 // filter_out(e) must be a valid expression whose value is convertible
@@ -172,6 +203,22 @@ class SATBMarkQueueSet: public PtrQueueSet {
 // retained if false.
 template<typename Filter>
 inline void SATBMarkQueueSet::apply_filter(Filter filter_out, SATBMarkQueue& queue) {
+  if (SATBBufferFilterDuplicates) {
+    // Each entry is passed to the filter exactly once, so discarding an
+    // entry that was seen before retains a single copy of it.  Check the
+    // cache first to avoid filter_out's mark bitmap lookup for repeats.
+    SATBRecentEntries recent;
+    apply_filter_impl([&](void* entry) {
+                        return recent.check_and_record(entry) || filter_out(entry);
+                      },
+                      queue);
+  } else {
+    apply_filter_impl(filter_out, queue);
+  }
+}
+
+template<typename Filter>
+inline void SATBMarkQueueSet::apply_filter_impl(Filter filter_out, SATBMarkQueue& queue) {
   void** buf = queue.buffer();
 
   if (buf == nullptr) {
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/softMaxHeapSizeUpdater.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class SoftMaxHeapSizeUpdaterTask : public PeriodicTask {
+  julong _last_physical_memory;
+
+  static size_t soft_max_for(julong physical_memory) {
+    const julong target = (julong)((double)physical_memory * MaxRAMPercentage / 100);
+    return (size_t)clamp(target, (julong)MinHeapSize, (julong)MaxHeapSize);
+  }
+
+public:
+  SoftMaxHeapSizeUpdaterTask(size_t interval_ms) :
+    PeriodicTask(interval_ms),
+    _last_physical_memory(os::physical_memory()) {}
+
+  void task() override {
+    const julong physical_memory = os::physical_memory();
+    if (physical_memory == _last_physical_memory) {
+      return;
+    }
+    _last_physical_memory = physical_memory;
+
+    // Leave a SoftMaxHeapSize set by the user at runtime (through jcmd or
+    // JMX) alone.
+    if (!FLAG_IS_DEFAULT(SoftMaxHeapSize) && !FLAG_IS_ERGO(SoftMaxHeapSize)) {
+      return;
+    }
+    const size_t soft_max = soft_max_for(physical_memory);
+    log_info(gc, ergo)("Physical memory changed to " JULONG_FORMAT "M, setting SoftMaxHeapSize to " SIZE_FORMAT "M",
+                       physical_memory / M, soft_max / M);
+    FLAG_SET_ERGO(SoftMaxHeapSize, soft_max);
+  }
+};
+
+void SoftMaxHeapSizeUpdater::initialize() {
+  assert(enabled(), "must be");
+  // An explicit heap size takes precedence over the memory limit; with
+  // -Xmx set, MaxRAMPercentage of the limit has no relation to the heap
+  // size the user asked for.
+  if (FLAG_IS_CMDLINE(MaxHeapSize) || FLAG_IS_CMDLINE(SoftMaxHeapSize)) {
+    log_info(gc, ergo)("SoftMaxHeapSize does not follow the memory limit: %s set on the command line",
+                       FLAG_IS_CMDLINE(MaxHeapSize) ? "MaxHeapSize" : "SoftMaxHeapSize");
+    return;
+  }
+  // Check about once a second; limit changes are rare and the collectors
+  // only react to SoftMaxHeapSize at their own pace anyway.
+  SoftMaxHeapSizeUpdaterTask* task = new SoftMaxHeapSizeUpdaterTask(1000);
+  task->enroll();
+}
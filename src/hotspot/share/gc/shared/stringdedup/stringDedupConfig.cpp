@@ -39,6 +39,7 @@ double StringDedup::Config::_load_factor_for_shrink;
 double StringDedup::Config::_load_factor_target;
 size_t StringDedup::Config::_minimum_dead_for_cleanup;
 double StringDedup::Config::_dead_factor_for_cleanup;
+double StringDedup::Config::_max_active_fraction;
 uint64_t StringDedup::Config::_hash_seed;
 
 size_t StringDedup::Config::initial_table_size() {
@@ -49,6 +50,10 @@ int StringDedup::Config::age_threshold() {
   return _age_threshold;
 }
 
+double StringDedup::Config::max_active_fraction() {
+  return _max_active_fraction;
+}
+
 bool StringDedup::Config::should_cleanup_table(size_t entry_count, size_t dead_count) {
   return (dead_count > _minimum_dead_for_cleanup) &&
          (dead_count > (entry_count * _dead_factor_for_cleanup));
@@ -162,5 +167,6 @@ void StringDedup::Config::initialize() {
   _load_factor_target = StringDeduplicationTargetTableLoad;
   _minimum_dead_for_cleanup = StringDeduplicationCleanupDeadMinimum;
   _dead_factor_for_cleanup = StringDeduplicationCleanupDeadPercent / 100.0;
+  _max_active_fraction = StringDeduplicationMaxActivePercent / 100.0;
   _hash_seed = initial_hash_seed();
 }
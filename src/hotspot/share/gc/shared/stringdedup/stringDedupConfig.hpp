@@ -40,6 +40,7 @@ class StringDedup::Config : AllStatic {
   static double _load_factor_target;
   static size_t _minimum_dead_for_cleanup;
   static double _dead_factor_for_cleanup;
+  static double _max_active_fraction;
   static uint64_t _hash_seed;
 
   static const size_t good_sizes[];
@@ -56,6 +57,7 @@ class StringDedup::Config : AllStatic {
 
   static size_t initial_table_size();
   static int age_threshold();
+  static double max_active_fraction();
   static uint64_t hash_seed();
 
   static size_t grow_threshold(size_t table_size);
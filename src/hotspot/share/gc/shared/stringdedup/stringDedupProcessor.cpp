@@ -29,6 +29,7 @@
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/stringdedup/stringDedupConfig.hpp"
 #include "gc/shared/stringdedup/stringDedupProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "gc/shared/stringdedup/stringDedupStorageUse.hpp"
@@ -41,9 +42,11 @@
 #include "runtime/cpuTimeCounters.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
 
 OopStorage* StringDedup::Processor::_storages[2] = {};
 
@@ -108,6 +111,12 @@ void StringDedup::Processor::yield() const {
   ThreadBlockInVM tbivm(_thread);
 }
 
+void StringDedup::Processor::sleep(jlong millis) const {
+  assert(Thread::current() == _thread, "precondition");
+  ThreadBlockInVM tbivm(_thread);
+  os::naked_short_sleep(millis);
+}
+
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
   if (Table::cleanup_start_if_needed(grow_only, force)) {
     do {
@@ -122,6 +131,14 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
+  // State for limiting the fraction of time spent processing to
+  // StringDeduplicationMaxActivePercent.
+  static const uint throttle_check_interval = 256;
+  static const jlong max_throttle_millis = 100;
+  Ticks _start;
+  double _slept_seconds;
+  uint _since_throttle_check;
+
   void release_ref(oop* ref) {
     assert(_release_index < ARRAY_SIZE(_bulk_release), "invariant");
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(ref, nullptr);
@@ -132,11 +149,36 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
     }
   }
 
+  // Sleep if processing has used more than its share of the time since
+  // processing started. Sleeping is excluded from the process time.
+  void maybe_throttle() {
+    double const max_active = Config::max_active_fraction();
+    if ((max_active >= 1.0) || (++_since_throttle_check < throttle_check_interval)) {
+      return;
+    }
+    _since_throttle_check = 0;
+    double const elapsed = (Ticks::now() - _start).seconds();
+    double const busy = elapsed - _slept_seconds;
+    jlong const millis = (jlong)((busy / max_active - elapsed) * MILLIUNITS);
+    if (millis > 0) {
+      _cur_stat.report_process_pause();
+      Ticks sleep_start = Ticks::now();
+      _processor->sleep(MIN2(millis, max_throttle_millis));
+      Tickspan slept = Ticks::now() - sleep_start;
+      _slept_seconds += slept.seconds();
+      _cur_stat.report_throttle(slept);
+      _cur_stat.report_process_resume();
+    }
+  }
+
 public:
   ProcessRequest(OopStorage* storage) :
     _storage(storage),
     _release_index(0),
-    _bulk_release()
+    _bulk_release(),
+    _start(Ticks::now()),
+    _slept_seconds(0.0),
+    _since_throttle_check(0)
   {}
 
   ~ProcessRequest() {
@@ -147,6 +189,7 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
 
   virtual void do_oop(oop* ref) {
     _processor->yield();
+    maybe_throttle();
     oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
     release_ref(ref);
     // Dedup java_string, after checking for various reasons to skip it.
@@ -62,6 +62,9 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   // Yield if requested.
   void yield() const;
 
+  // Sleep for the given number of milliseconds, allowing safepoints.
+  void sleep(jlong millis) const;
+
   class ProcessRequest;
   void process_requests() const;
   void cleanup_table(bool grow_only, bool force) const;
@@ -45,13 +45,15 @@ StringDedup::Stat::Stat() :
   _process(0),
   _resize_table(0),
   _cleanup_table(0),
+  _throttle(0),
   _active_start(),
   _active_elapsed(),
   _phase_start(),
   _idle_elapsed(),
   _process_elapsed(),
   _resize_table_elapsed(),
-  _cleanup_table_elapsed()
+  _cleanup_table_elapsed(),
+  _throttle_elapsed()
 {}
 
 void StringDedup::Stat::add(const Stat* const stat) {
@@ -72,11 +74,13 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _process             += stat->_process;
   _resize_table        += stat->_resize_table;
   _cleanup_table       += stat->_cleanup_table;
+  _throttle            += stat->_throttle;
   _active_elapsed      += stat->_active_elapsed;
   _idle_elapsed        += stat->_idle_elapsed;
   _process_elapsed     += stat->_process_elapsed;
   _resize_table_elapsed += stat->_resize_table_elapsed;
   _cleanup_table_elapsed += stat->_cleanup_table_elapsed;
+  _throttle_elapsed    += stat->_throttle_elapsed;
 }
 
 // Support for log output formatting
@@ -163,6 +167,11 @@ void StringDedup::Stat::report_process_end() {
   report_phase_end("Process", &_process_elapsed);
 }
 
+void StringDedup::Stat::report_throttle(Tickspan elapsed) {
+  _throttle++;
+  _throttle_elapsed += elapsed;
+}
+
 void StringDedup::Stat::report_resize_table_start(size_t new_bucket_count,
                                                   size_t old_bucket_count,
                                                   size_t entry_count) {
@@ -207,6 +216,16 @@ void StringDedup::Stat::log_times(const char* prefix) const {
       "  %s Cleanup Table: %zu/" STRDEDUP_ELAPSED_FORMAT_MS,
       prefix, _cleanup_table, strdedup_elapsed_param_ms(_cleanup_table_elapsed));
   }
+  if (_throttle > 0) {
+    log_debug(stringdedup)(
+      "  %s Throttle: %zu/" STRDEDUP_ELAPSED_FORMAT_MS,
+      prefix, _throttle, strdedup_elapsed_param_ms(_throttle_elapsed));
+  }
+}
+
+double StringDedup::Stat::inspected_per_second() const {
+  double const seconds = _process_elapsed.seconds();
+  return (seconds > 0.0) ? (_inspected / seconds) : 0.0;
 }
 
 void StringDedup::Stat::log_statistics(bool total) const {
@@ -229,4 +248,5 @@ void StringDedup::Stat::log_statistics(bool total) const {
                          _deduped, deduped_percent, STRDEDUP_BYTES_PARAM(_deduped_bytes), deduped_bytes_percent);
   log_debug(stringdedup)("    Skipped: %zu (dead), %zu (incomplete), %zu (shared)",
                          _skipped_dead, _skipped_incomplete, _skipped_shared);
+  log_debug(stringdedup)("    Throughput:   %12.1f/s", inspected_per_second());
 }
@@ -55,6 +55,7 @@ class StringDedup::Stat {
   size_t _process;
   size_t _resize_table;
   size_t _cleanup_table;
+  size_t _throttle;
 
   // Time spent by the deduplication thread in different phases
   Ticks _active_start;
@@ -66,12 +67,18 @@ class StringDedup::Stat {
   Tickspan _process_elapsed;
   Tickspan _resize_table_elapsed;
   Tickspan _cleanup_table_elapsed;
+  // Time the processing thread slept to stay within its CPU budget.
+  // Excluded from _process_elapsed.
+  Tickspan _throttle_elapsed;
 
   void report_phase_start(const char* phase);
   void report_phase_end(const char* phase, Tickspan* elapsed);
 
   void log_times(const char* prefix) const;
 
+  // Number of strings inspected per second of processing time.
+  double inspected_per_second() const;
+
 public:
   Stat();
 
@@ -136,6 +143,8 @@ class StringDedup::Stat {
   void report_process_resume();
   void report_process_end();
 
+  void report_throttle(Tickspan elapsed);
+
   void report_resize_table_start(size_t new_bucket_count,
                                  size_t old_bucket_count,
                                  size_t entry_count);
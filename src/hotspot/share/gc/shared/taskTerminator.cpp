@@ -31,9 +31,11 @@
 #include "runtime/globals.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 
-TaskTerminator::DelayContext::DelayContext() {
+TaskTerminator::DelayContext::DelayContext(uint yield_limit) {
   _yield_count = 0;
+  _yield_limit = yield_limit;
   reset_hard_spin_information();
 }
 
@@ -43,11 +45,11 @@ void TaskTerminator::DelayContext::reset_hard_spin_information() {
 }
 
 bool TaskTerminator::DelayContext::needs_sleep() const {
-  return _yield_count >= WorkStealingYieldsBeforeSleep;
+  return _yield_count >= _yield_limit;
 }
 
 void TaskTerminator::DelayContext::do_step() {
-  assert(_yield_count < WorkStealingYieldsBeforeSleep, "Number of yields too large");
+  assert(_yield_count < _yield_limit, "Number of yields too large");
   // Each spin iteration is counted as a yield for purposes of
   // deciding when to sleep.
   _yield_count++;
@@ -73,7 +75,8 @@ TaskTerminator::TaskTerminator(uint n_threads, TaskQueueSetSuper* queue_set) :
   _queue_set(queue_set),
   _offered_termination(0),
   _blocker(Mutex::nosafepoint, "TaskTerminator_lock"),
-  _spin_master(nullptr) { }
+  _spin_master(nullptr),
+  _yield_limit(initial_yield_limit()) { }
 
 TaskTerminator::~TaskTerminator() {
   if (_offered_termination != 0) {
@@ -101,6 +104,39 @@ void TaskTerminator::reset_for_reuse() {
 void TaskTerminator::reset_for_reuse(uint n_threads) {
   reset_for_reuse();
   _n_threads = n_threads;
+  // Keep what has been learned so far unless the new thread count makes
+  // the machine oversubscribed.
+  _yield_limit = MIN2(_yield_limit, initial_yield_limit());
+}
+
+uint TaskTerminator::min_yield_limit() const {
+  return MAX2((uint)(WorkStealingYieldsBeforeSleep >> 6), 1u);
+}
+
+uint TaskTerminator::initial_yield_limit() const {
+  if (UseAdaptiveTaskTermination &&
+      (uint)os::active_processor_count() < _n_threads) {
+    // Spinning threads take CPU away from the threads that still have work,
+    // so sleep early.
+    return min_yield_limit();
+  }
+  return (uint)WorkStealingYieldsBeforeSleep;
+}
+
+void TaskTerminator::update_yield_limit(bool spin_succeeded) {
+  assert(_blocker.owned_by_self(), "must be");
+  if (!UseAdaptiveTaskTermination) {
+    return;
+  }
+  uint const old_limit = _yield_limit;
+  if (spin_succeeded) {
+    _yield_limit = MIN2(2 * _yield_limit, (uint)WorkStealingYieldsBeforeSleep);
+  } else {
+    _yield_limit = MAX2(_yield_limit / 2, min_yield_limit());
+  }
+  if (old_limit != _yield_limit) {
+    log_trace(gc, task)("Termination spin limit %u -> %u", old_limit, _yield_limit);
+  }
 }
 
 bool TaskTerminator::exit_termination(size_t tasks, TerminatorTerminator* terminator) {
@@ -154,7 +190,7 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
   for (;;) {
     if (_spin_master == nullptr) {
       _spin_master = the_thread;
-      DelayContext delay_context;
+      DelayContext delay_context(_yield_limit);
 
       while (!delay_context.needs_sleep()) {
         size_t tasks;
@@ -169,15 +205,18 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
         }
         // Immediately check exit conditions after re-acquiring the lock.
         if (_offered_termination == _n_threads) {
+          update_yield_limit(true /* spin_succeeded */);
           prepare_for_return(the_thread);
           assert_queue_set_empty();
           return true;
         } else if (should_exit_termination) {
+          update_yield_limit(true /* spin_succeeded */);
           prepare_for_return(the_thread, tasks);
           _offered_termination--;
           return false;
         }
       }
+      update_yield_limit(false /* spin_succeeded */);
       // Give up spin master before sleeping.
       _spin_master = nullptr;
     }
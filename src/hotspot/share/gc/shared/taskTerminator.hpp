@@ -54,6 +54,8 @@ class Thread;
 class TaskTerminator : public CHeapObj<mtGC> {
   class DelayContext {
     uint _yield_count;
+    // Number of yields after which the caller should sleep.
+    uint _yield_limit;
     // Number of hard spin loops done since last yield
     uint _hard_spin_count;
     // Number of iterations in the current hard spin loop.
@@ -61,7 +63,7 @@ class TaskTerminator : public CHeapObj<mtGC> {
 
     void reset_hard_spin_information();
   public:
-    DelayContext();
+    DelayContext(uint yield_limit);
 
     // Should the caller sleep (wait) or perform a spin step?
     bool needs_sleep() const;
@@ -79,6 +81,16 @@ class TaskTerminator : public CHeapObj<mtGC> {
   Monitor _blocker;
   Thread* _spin_master;
 
+  // Number of delay steps the spin master performs before it sleeps. This is
+  // WorkStealingYieldsBeforeSleep unless UseAdaptiveTaskTermination is set,
+  // in which case it shrinks when spinning did not find new work or the
+  // termination condition, and grows back when it did. Protected by _blocker.
+  uint _yield_limit;
+
+  uint min_yield_limit() const;
+  uint initial_yield_limit() const;
+  void update_yield_limit(bool spin_succeeded);
+
   void assert_queue_set_empty() const NOT_DEBUG_RETURN;
 
   // Prepare for return from offer_termination. Gives up the spin master token
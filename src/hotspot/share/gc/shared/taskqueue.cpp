@@ -36,6 +36,7 @@
 const char * const TaskQueueStats::_names[last_stat_id] = {
   "push", "pop", "pop-slow",
   "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop",
+  "st-local", "st-remote",
   "ovflw-push", "ovflw-max"
 };
 
@@ -106,6 +107,9 @@ void TaskQueueStats::verify() const
   assert(get(steal_empty) + get(steal_contended) + get(steal_success) == get(steal_attempt),
          "steal_empty=%zu steal_contended=%zu steal_success=%zu steal_attempt=%zu",
          get(steal_empty), get(steal_contended), get(steal_success), get(steal_attempt));
+  assert(get(steal_local) + get(steal_remote) <= get(steal_success),
+         "steal_local=%zu steal_remote=%zu steal_success=%zu",
+         get(steal_local), get(steal_remote), get(steal_success));
   assert(get(overflow) == 0 || get(push) != 0,
          "overflow=%zu push=%zu",
          get(overflow), get(push));
@@ -61,6 +61,8 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_local,      // subset of successful steals from a queue on the same NUMA node
+    steal_remote,     // subset of successful steals from a queue on another NUMA node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +84,9 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_locality(bool local) {
+    ++_stats[local ? steal_local : steal_remote];
+  }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -404,10 +409,21 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
 
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
-  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int));
+  // The NUMA group the owner of this queue was running on when it last
+  // went stealing, or InvalidNUMAGroupId if it has not stolen yet. Written
+  // by the owner only, read by other stealers when preferring node-local
+  // victims.
+  static const int InvalidNUMAGroupId = -1;
+  volatile int _numa_group_id;
+
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + 2 * sizeof(int));
 public:
   int next_random_queue_id();
 
+  void update_numa_group_id();
+  int numa_group_id() const                  { return Atomic::load(&_numa_group_id); }
+  bool is_numa_group_id_valid() const        { return numa_group_id() != InvalidNUMAGroupId; }
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -482,8 +498,18 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
 
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
-  // as for the last pop_global() operation.
-  PopResult steal_best_of_2(uint queue_num, E& t);
+  // as for the last pop_global() operation. If node_local is set, only
+  // queues whose owners last ran on the same NUMA node as the owner of
+  // queue_num are considered.
+  PopResult steal_best_of_2(uint queue_num, E& t, bool node_local);
+
+  // Returns a random queue id, different from queue_num and exclude, whose
+  // owner last ran on the same NUMA node as the owner of queue_num. Returns
+  // queue_num if none was found within a bounded number of samples.
+  uint random_node_local_queue(uint queue_num, uint exclude);
+
+  // Whether steal() should prefer node-local victims.
+  bool is_numa_aware_stealing() const;
 
 public:
   GenericTaskQueueSet(uint n);
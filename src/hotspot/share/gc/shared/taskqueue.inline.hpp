@@ -33,7 +33,9 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -101,7 +103,8 @@ template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, F)),
   _last_stolen_queue_id(InvalidQueueId),
-  _seed(17 /* random number */) {}
+  _seed(17 /* random number */),
+  _numa_group_id(InvalidNUMAGroupId) {}
 
 template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::~GenericTaskQueue() {
@@ -316,24 +319,72 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class E, MEMFLAGS F, unsigned int N>
+void GenericTaskQueue<E, F, N>::update_numa_group_id() {
+  int lgrp_id = os::numa_get_group_id();
+  if (lgrp_id != numa_group_id()) {
+    Atomic::store(&_numa_group_id, lgrp_id);
+  }
+}
+
+template<class T, MEMFLAGS F>
+bool GenericTaskQueueSet<T, F>::is_numa_aware_stealing() const {
+  return UseNUMA && UseNUMATaskStealing && _n > 2;
+}
+
 template<class T, MEMFLAGS F>
-typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
+uint GenericTaskQueueSet<T, F>::random_node_local_queue(uint queue_num, uint exclude) {
+  T* const local_queue = queue(queue_num);
+  int const lgrp_id = local_queue->numa_group_id();
+  // Bound the sampling so that a steal attempt stays cheap even if there
+  // are few or no node-local queues.
+  uint const max_samples = MIN2(_n, 8u);
+  for (uint i = 0; i < max_samples; i++) {
+    uint k = local_queue->next_random_queue_id() % _n;
+    if (k != queue_num && k != exclude && queue(k)->numa_group_id() == lgrp_id) {
+      return k;
+    }
+  }
+  return queue_num;
+}
+
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t, bool node_local) {
   T* const local_queue = queue(queue_num);
   if (_n > 2) {
     uint k1 = queue_num;
-
-    if (local_queue->is_last_stolen_queue_id_valid()) {
-      k1 = local_queue->last_stolen_queue_id();
-      assert(k1 != queue_num, "Should not be the same");
+    uint k2 = queue_num;
+    int const lgrp_id = local_queue->numa_group_id();
+
+    if (node_local) {
+      if (local_queue->is_last_stolen_queue_id_valid() &&
+          queue(local_queue->last_stolen_queue_id())->numa_group_id() == lgrp_id) {
+        k1 = local_queue->last_stolen_queue_id();
+      } else {
+        k1 = random_node_local_queue(queue_num, queue_num);
+      }
+      if (k1 == queue_num) {
+        // No node-local victim found.
+        return PopResult::Empty;
+      }
+      k2 = random_node_local_queue(queue_num, k1);
+      if (k2 == queue_num) {
+        // Only one node-local victim found; compare it with itself.
+        k2 = k1;
+      }
     } else {
-      while (k1 == queue_num) {
-        k1 = local_queue->next_random_queue_id() % _n;
+      if (local_queue->is_last_stolen_queue_id_valid()) {
+        k1 = local_queue->last_stolen_queue_id();
+        assert(k1 != queue_num, "Should not be the same");
+      } else {
+        while (k1 == queue_num) {
+          k1 = local_queue->next_random_queue_id() % _n;
+        }
       }
-    }
 
-    uint k2 = queue_num;
-    while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
+      while (k2 == queue_num || k2 == k1) {
+        k2 = local_queue->next_random_queue_id() % _n;
+      }
     }
     // Sample both and try the larger.
     uint sz1 = queue(k1)->size();
@@ -354,7 +405,14 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
-    } else {
+      TASKQUEUE_STATS_ONLY(
+        if (local_queue->is_numa_group_id_valid()) {
+          local_queue->stats.record_steal_locality(queue(sel_k)->numa_group_id() == lgrp_id);
+        }
+      )
+    } else if (!node_local) {
+      // A failed node-local attempt keeps the bias; the fallback to any
+      // queue below will drop it if that fails too.
       local_queue->invalidate_last_stolen_queue_id();
     }
 
@@ -376,9 +434,21 @@ template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  // With NUMA-aware stealing the first half of the attempts only target
+  // queues whose owners run on the same node, so that stolen work (and
+  // the memory it references) tends to stay node-local.
+  uint num_local_retries = 0;
+  if (is_numa_aware_stealing()) {
+    T* const local_queue = queue(queue_num);
+    local_queue->update_numa_group_id();
+    if (local_queue->is_numa_group_id_valid()) {
+      num_local_retries = _n;
+    }
+  }
+
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    PopResult sr = steal_best_of_2(queue_num, t, i < num_local_retries);
     if (sr == PopResult::Success) {
       return true;
     } else if (sr == PopResult::Contended) {
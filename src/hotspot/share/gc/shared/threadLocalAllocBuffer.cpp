@@ -52,6 +52,7 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _allocated_before_last_gc(0),
   _bytes_since_last_sample_point(0),
   _number_of_refills(0),
+  _burst_refill_threshold(0),
   _refill_waste(0),
   _gc_waste(0),
   _slow_allocations(0),
@@ -172,8 +173,29 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+void ThreadLocalAllocBuffer::grow_for_allocation_burst() {
+  if (!ResizeTLAB || !TLABBurstResize || _number_of_refills < _burst_refill_threshold) {
+    return;
+  }
+  // The thread already used up its share of eden for this GC interval at
+  // the current size. Double the size for the next refill, and wait half
+  // the target number of refills before growing again. The size is brought
+  // back in line with the allocation history by resize() at the next GC.
+  size_t new_size = align_object_size(MIN2(2 * desired_size(), max_size()));
+  _burst_refill_threshold = _number_of_refills + MAX2(_target_refills / 2, 1u);
+  if (new_size == desired_size()) {
+    return;
+  }
+  log_trace(gc, tlab)("TLAB burst: thread: " PTR_FORMAT " [id: %2d]"
+                      " refills %u desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      _number_of_refills, desired_size(), new_size);
+  set_desired_size(new_size);
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
+  _burst_refill_threshold = _target_refills;
   _refill_waste      = 0;
   _gc_waste          = 0;
   _slow_allocations  = 0;
@@ -186,6 +208,7 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+  grow_for_allocation_burst();
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
@@ -63,6 +63,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   static unsigned _target_refills;                    // expected number of refills between GCs
 
   unsigned  _number_of_refills;
+  unsigned  _burst_refill_threshold;             // refills after which the desired size is grown (TLABBurstResize)
   unsigned  _refill_waste;
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
@@ -72,6 +73,10 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
 
   void reset_statistics();
 
+  // Grow the desired size if this thread refills much more often than
+  // expected since the last GC.
+  void grow_for_allocation_burst();
+
   void set_start(HeapWord* start)                { _start = start; }
   void set_end(HeapWord* end)                    { _end = end; }
   void set_allocation_end(HeapWord* ptr)         { _allocation_end = ptr; }
@@ -42,6 +42,10 @@
   product(bool, ResizeTLAB, true,                                           \
           "Dynamically resize TLAB size for threads")                       \
                                                                             \
+  product(bool, TLABBurstResize, false, EXPERIMENTAL,                       \
+          "Temporarily grow the TLAB size of a thread that refills more "   \
+          "often than expected between GCs. Requires ResizeTLAB")           \
+                                                                            \
   product(bool, ZeroTLAB, false,                                            \
           "Zero out the newly created TLAB")                                \
                                                                             \
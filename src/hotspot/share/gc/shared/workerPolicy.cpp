@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/workerPolicy.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "runtime/globals_extension.hpp"
@@ -175,3 +176,60 @@ uint WorkerPolicy::calc_active_conc_workers(uintx total_workers,
     return no_of_gc_threads;
   }
 }
+
+WorkerCountFeedback::WorkerCountFeedback() : _num_phases(0) {}
+
+WorkerCountFeedback::Phase* WorkerCountFeedback::find_or_add(const char* name) {
+  for (uint i = 0; i < _num_phases; i++) {
+    if (strcmp(_phases[i]._name, name) == 0) {
+      return &_phases[i];
+    }
+  }
+  if (_num_phases == MaxPhases) {
+    return nullptr;
+  }
+  Phase* phase = &_phases[_num_phases++];
+  phase->_name = name;
+  phase->_limit = 0;
+  return phase;
+}
+
+uint WorkerCountFeedback::num_workers(const char* name, uint num_workers) {
+  if (!UseGCWorkerCountFeedback) {
+    return num_workers;
+  }
+  Phase* phase = find_or_add(name);
+  if (phase == nullptr || phase->_limit == 0) {
+    return num_workers;
+  }
+  return MIN2(phase->_limit, num_workers);
+}
+
+void WorkerCountFeedback::update(const char* name, uint num_workers, const WorkerThreads* workers) {
+  if (!UseGCWorkerCountFeedback) {
+    return;
+  }
+  Phase* phase = find_or_add(name);
+  if (phase == nullptr) {
+    return;
+  }
+  const double efficiency = workers->last_task_efficiency();
+  const double min_efficiency = GCWorkerMinParallelEfficiency / 100.0;
+  const uint prev_limit = phase->_limit;
+  if (efficiency < min_efficiency && num_workers > 1) {
+    // Too much of the available worker time was lost; back off by a quarter.
+    phase->_limit = num_workers - MAX2(1u, num_workers / 4);
+  } else if (phase->_limit != 0 &&
+             num_workers >= phase->_limit &&
+             efficiency >= (1.0 + min_efficiency) / 2) {
+    // Scaled well at the limit; try again with more workers.
+    phase->_limit += MAX2(1u, phase->_limit / 4);
+    if (phase->_limit >= workers->max_workers()) {
+      phase->_limit = 0;
+    }
+  }
+  if (phase->_limit != prev_limit) {
+    log_debug(gc, task)("%s: parallel efficiency %1.2f with %u workers, worker limit %u -> %u",
+                        name, efficiency, num_workers, prev_limit, phase->_limit);
+  }
+}
@@ -25,9 +25,12 @@
 #ifndef SHARE_GC_SHARED_WORKERPOLICY_HPP
 #define SHARE_GC_SHARED_WORKERPOLICY_HPP
 
+#include "memory/allocation.hpp"
 #include "memory/allStatic.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class WorkerThreads;
+
 class WorkerPolicy : public AllStatic {
   static const uint GCWorkersPerJavaThread = 2;
 
@@ -74,4 +77,37 @@ class WorkerPolicy : public AllStatic {
 
 };
 
+// Per-phase feedback for UseGCWorkerCountFeedback.  Phases are identified
+// by the name of the WorkerTask implementing them.  After each execution of
+// a phase, the parallel efficiency measured by WorkerThreads is used to
+// adjust a limit on the number of workers for the next execution: a phase
+// that leaves too many of its workers idle gets fewer workers, and a phase
+// that scales well at its limit is probed with more.
+class WorkerCountFeedback : public CHeapObj<mtGC> {
+  static const uint MaxPhases = 16;
+
+  struct Phase {
+    const char* _name;
+    uint _limit;                // 0 if the number of workers is not limited.
+  };
+
+  Phase _phases[MaxPhases];
+  uint _num_phases;
+
+  // Returns the entry for the phase with the given name, or null if an entry
+  // could not be created.
+  Phase* find_or_add(const char* name);
+
+public:
+  WorkerCountFeedback();
+
+  // Returns the number of workers to use for the named phase, at most
+  // num_workers.
+  uint num_workers(const char* name, uint num_workers);
+
+  // Updates the limit for the named phase from the parallel efficiency of
+  // the last task run by workers, using num_workers workers.
+  void update(const char* name, uint num_workers, const WorkerThreads* workers);
+};
+
 #endif // SHARE_GC_SHARED_WORKERPOLICY_HPP
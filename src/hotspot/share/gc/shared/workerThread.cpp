@@ -32,11 +32,13 @@
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
+#include "utilities/ticks.hpp"
 
 WorkerTaskDispatcher::WorkerTaskDispatcher() :
     _task(nullptr),
     _started(0),
     _not_finished(0),
+    _busy_ticks(0),
     _start_semaphore(),
     _end_semaphore() {}
 
@@ -44,6 +46,7 @@ void WorkerTaskDispatcher::coordinator_distribute_task(WorkerTask* task, uint nu
   // No workers are allowed to read the state variables until they have been signaled.
   _task = task;
   _not_finished = num_workers;
+  _busy_ticks = 0;
 
   // Dispatch 'num_workers' number of tasks.
   _start_semaphore.signal(num_workers);
@@ -67,7 +70,14 @@ void WorkerTaskDispatcher::worker_run_task() {
 
   // Run task.
   GCIdMark gc_id_mark(_task->gc_id());
-  _task->work(worker_id);
+  if (UseGCWorkerCountFeedback) {
+    // Measure the busy time for the worker count feedback.
+    const Ticks start = Ticks::now();
+    _task->work(worker_id);
+    Atomic::add(&_busy_ticks, (Ticks::now() - start).value(), memory_order_relaxed);
+  } else {
+    _task->work(worker_id);
+  }
 
   // Mark that the worker is done with the task.
   // The worker is not allowed to read the state variables after this line.
@@ -85,7 +95,8 @@ WorkerThreads::WorkerThreads(const char* name, uint max_workers) :
     _max_workers(max_workers),
     _created_workers(0),
     _active_workers(0),
-    _dispatcher() {}
+    _dispatcher(),
+    _last_task_efficiency(1.0) {}
 
 void WorkerThreads::initialize_workers() {
   const uint initial_active_workers = UseDynamicNumberOfGCThreads ? 1 : _max_workers;
@@ -178,7 +189,16 @@ void WorkerThreads::clear_indirect_states() {
 
 void WorkerThreads::run_task(WorkerTask* task) {
   set_indirect_states();
-  _dispatcher.coordinator_distribute_task(task, _active_workers);
+  if (UseGCWorkerCountFeedback) {
+    const Ticks start = Ticks::now();
+    _dispatcher.coordinator_distribute_task(task, _active_workers);
+    const jlong elapsed = (Ticks::now() - start).value();
+    if (elapsed > 0) {
+      _last_task_efficiency = MIN2(1.0, (double)_dispatcher.busy_ticks() / ((double)elapsed * _active_workers));
+    }
+  } else {
+    _dispatcher.coordinator_distribute_task(task, _active_workers);
+  }
   clear_indirect_states();
 }
 
@@ -61,6 +61,9 @@ class WorkerTaskDispatcher {
   volatile uint _started;
   volatile uint _not_finished;
 
+  // Sum of the time, in ticks, the workers spent running the task.
+  volatile jlong _busy_ticks;
+
   // Semaphore used to start the WorkerThreads.
   Semaphore _start_semaphore;
   // Semaphore used to notify the coordinator that all workers are done.
@@ -75,6 +78,9 @@ class WorkerTaskDispatcher {
   // Returns when the task has been completed by all workers.
   void coordinator_distribute_task(WorkerTask* task, uint num_workers);
 
+  // Sum of the time the workers spent running the last distributed task.
+  jlong busy_ticks() const { return _busy_ticks; }
+
   // Worker API.
 
   // Waits for a task to become available to the worker and runs it.
@@ -90,6 +96,7 @@ class WorkerThreads : public CHeapObj<mtInternal> {
   uint                 _created_workers;
   uint                 _active_workers;
   WorkerTaskDispatcher _dispatcher;
+  double               _last_task_efficiency;
 
   WorkerThread* create_worker(uint name_suffix);
 
@@ -116,6 +123,12 @@ class WorkerThreads : public CHeapObj<mtInternal> {
 
   const char* name() const { return _name; }
 
+  // The fraction of the available worker time, i.e. the elapsed time of
+  // the task times the number of workers, that the workers spent running
+  // the last task.  Workers that start late or run out of work early lower
+  // this value.
+  double last_task_efficiency() const { return _last_task_efficiency; }
+
   // Run a task using the current active number of workers, returns when the task is done.
   void run_task(WorkerTask* task);
 
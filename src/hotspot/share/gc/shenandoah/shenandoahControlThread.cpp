@@ -200,6 +200,7 @@ void ShenandoahControlThread::run_service() {
       // to capture the state at the end of GC session.
       heap->handle_force_counters_update();
       heap->set_forced_counters_update(false);
+      heap->update_gc_threads_cpu_time();
 
       // Retract forceful part of soft refs policy
       heap->soft_ref_policy()->set_should_clear_all_soft_refs(false);
@@ -30,6 +30,7 @@
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
@@ -402,26 +403,60 @@ void ShenandoahFreeSet::clear_internal() {
   _used = 0;
 }
 
-void ShenandoahFreeSet::rebuild() {
-  shenandoah_assert_heaplocked();
-  clear();
+class ShenandoahFindFreeRegionsClosure : public ShenandoahHeapRegionClosure {
+private:
+  ShenandoahFreeSet* const _free_set;
+  volatile size_t _capacity;
 
-  for (size_t idx = 0; idx < _heap->num_regions(); idx++) {
-    ShenandoahHeapRegion* region = _heap->get_region(idx);
+public:
+  ShenandoahFindFreeRegionsClosure(ShenandoahFreeSet* free_set) :
+    _free_set(free_set), _capacity(0) {}
+
+  void heap_region_do(ShenandoahHeapRegion* region) {
     if (region->is_alloc_allowed() || region->is_trash()) {
       assert(!region->is_cset(), "Shouldn't be adding those to the free set");
 
       // Do not add regions that would surely fail allocation
-      if (has_no_alloc_capacity(region)) continue;
-
-      _capacity += alloc_capacity(region);
-      assert(_used <= _capacity, "must not use more than we have");
+      if (_free_set->has_no_alloc_capacity(region)) return;
 
-      assert(!is_mutator_free(idx), "We are about to add it, it shouldn't be there already");
-      _mutator_free_bitmap.set_bit(idx);
+      size_t idx = region->index();
+      assert(!_free_set->is_mutator_free(idx), "We are about to add it, it shouldn't be there already");
+      _free_set->_mutator_free_bitmap.par_set_bit(idx);
+      Atomic::add(&_capacity, _free_set->alloc_capacity(region), memory_order_relaxed);
     }
   }
 
+  bool is_thread_safe() { return true; }
+
+  size_t capacity() const { return Atomic::load(&_capacity); }
+};
+
+void ShenandoahFreeSet::rebuild() {
+  prepare_to_rebuild();
+  finish_rebuild();
+}
+
+void ShenandoahFreeSet::prepare_to_rebuild() {
+  shenandoah_assert_heaplocked();
+  clear();
+
+  // Scanning the regions is the bulk of the rebuild work and only touches
+  // per-region state, so spread it across the workers once they exist.
+  // The heap lock we hold keeps mutators away from the bitmaps meanwhile.
+  ShenandoahFindFreeRegionsClosure cl(this);
+  if (_heap->workers() != nullptr) {
+    _heap->parallel_heap_region_iterate(&cl);
+  } else {
+    _heap->heap_region_iterate(&cl);
+  }
+
+  _capacity = cl.capacity();
+  assert(_used <= _capacity, "must not use more than we have");
+}
+
+void ShenandoahFreeSet::finish_rebuild() {
+  shenandoah_assert_heaplocked();
+
   // Evac reserve: reserve trailing space for evacuations
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
   size_t reserved = 0;
@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahFindFreeRegionsClosure;
+
 private:
   ShenandoahHeap* const _heap;
   CHeapBitMap _mutator_free_bitmap;
@@ -76,6 +78,13 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   void clear();
   void rebuild();
 
+  // Rebuild in two steps, so callers can time them separately: the region
+  // scan that repopulates the mutator view runs on the workers, the serial
+  // fix-up that carves out the evacuation reserve only walks until the
+  // reserve is filled.
+  void prepare_to_rebuild();
+  void finish_rebuild();
+
   void recycle_trash();
 
   void log_status();
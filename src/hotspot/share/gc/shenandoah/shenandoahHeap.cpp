@@ -73,6 +73,7 @@
 #include "gc/shenandoah/shenandoahJfrSupport.hpp"
 #endif
 
+#include "cds/archiveHeapWriter.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
 #include "memory/classLoaderMetaspace.hpp"
@@ -82,6 +83,7 @@
 #include "oops/compressedOops.inline.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/cpuTimeCounters.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
@@ -437,6 +439,9 @@ jint ShenandoahHeap::initialize() {
 
   _control_thread = new ShenandoahControlThread();
 
+  CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+  CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_service);
+
   ShenandoahInitLogger::print();
 
   return JNI_OK;
@@ -1015,6 +1020,86 @@ HeapWord* ShenandoahHeap::mem_allocate(size_t size,
   return allocate_memory(req);
 }
 
+HeapWord* ShenandoahHeap::allocate_loaded_archive_space(size_t size) {
+#if INCLUDE_CDS_JAVA_HEAP
+  // CDS wants a contiguous memory range to load a bunch of objects.
+  // This bypasses the normal allocation paths, and needs a bit of
+  // massaging to keep GC invariants intact.
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_shared(size);
+
+  // Easy case: fits in a single regular region, nothing else to do.
+  if (size <= ShenandoahHeapRegion::humongous_threshold_words()) {
+    return allocate_memory(req);
+  }
+
+  // Hard case: the space would be allocated as humongous, but must look
+  // like a run of regular regions to the rest of GC. The archive writer
+  // guarantees that no object crosses a MIN_GC_REGION_ALIGNMENT boundary,
+  // so this only works when our regions are at least that large.
+  if (ShenandoahHeapRegion::region_size_bytes() < ArchiveHeapWriter::MIN_GC_REGION_ALIGNMENT) {
+    return nullptr;
+  }
+
+  HeapWord* mem = allocate_memory(req);
+  if (mem == nullptr) {
+    return nullptr;
+  }
+
+  size_t start_idx = heap_region_index_containing(mem);
+  size_t num_regions = ShenandoahHeapRegion::required_regions(size * HeapWordSize);
+
+  // Flip humongous -> regular.
+  {
+    ShenandoahHeapLocker locker(lock(), false);
+    for (size_t c = start_idx; c < start_idx + num_regions; c++) {
+      get_region(c)->make_regular_bypass();
+    }
+  }
+
+  return mem;
+#else
+  assert(false, "Archive heap loader should not be available");
+  return nullptr;
+#endif // INCLUDE_CDS_JAVA_HEAP
+}
+
+void ShenandoahHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  // Nothing to do here, except checking that the heap looks fine.
+#ifdef ASSERT
+  HeapWord* start = archive_space.start();
+  HeapWord* end = archive_space.end();
+
+  // No unclaimed space between the objects, and objects are in the
+  // right regions.
+  HeapWord* cur = start;
+  while (cur < end) {
+    oop obj = cast_to_oop(cur);
+    shenandoah_assert_in_correct_region(nullptr, obj);
+    cur += obj->size();
+  }
+
+  // No unclaimed tail at the end of archive space.
+  assert(cur == end,
+         "Archive space should be fully used: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(cur), p2i(end));
+
+  // Region bounds are good.
+  ShenandoahHeapRegion* begin_reg = heap_region_containing(start);
+  ShenandoahHeapRegion* end_reg = heap_region_containing(end - 1);
+  assert(begin_reg->is_regular(), "Must be");
+  assert(end_reg->is_regular(), "Must be");
+  assert(end_reg->top() >= end,
+         "Must agree: archive-space-end: " PTR_FORMAT ", end-region-top: " PTR_FORMAT,
+         p2i(end), p2i(end_reg->top()));
+  if (begin_reg != end_reg) {
+    // Multi-region space came from a humongous allocation.
+    assert(begin_reg->bottom() == start,
+           "Must agree: archive-space-start: " PTR_FORMAT ", begin-region-bottom: " PTR_FORMAT,
+           p2i(start), p2i(begin_reg->bottom()));
+  }
+#endif
+}
+
 MetaWord* ShenandoahHeap::satisfy_failed_metadata_allocation(ClassLoaderData* loader_data,
                                                              size_t size,
                                                              Metaspace::MetadataType mdtype) {
@@ -1298,6 +1383,31 @@ void ShenandoahHeap::gc_threads_do(ThreadClosure* tcl) const {
   }
 }
 
+void ShenandoahHeap::update_gc_threads_cpu_time() {
+  assert(Thread::current() == _control_thread, "Must be called from control thread");
+  if (!UsePerfData || !os::is_thread_cpu_time_supported()) {
+    return;
+  }
+
+  // Ensure ThreadTotalCPUTimeClosure destructors are called before
+  // publishing gc time.
+  {
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+    // The worker threads never terminate, so it is safe to read their CPU
+    // times.
+    workers()->threads_do(&tttc);
+    if (_safepoint_workers != nullptr) {
+      _safepoint_workers->threads_do(&tttc);
+    }
+  }
+  {
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::gc_service);
+    tttc.do_thread(_control_thread);
+  }
+
+  CPUTimeCounters::publish_gc_total_cpu_time();
+}
+
 void ShenandoahHeap::print_tracing_info() const {
   LogTarget(Info, gc, stats) lt;
   if (lt.is_enabled()) {
@@ -1770,7 +1880,16 @@ void ShenandoahHeap::prepare_regions_and_collection_set(bool concurrent) {
     ShenandoahGCPhase phase(concurrent ? ShenandoahPhaseTimings::final_rebuild_freeset :
                                          ShenandoahPhaseTimings::degen_gc_final_rebuild_freeset);
     ShenandoahHeapLocker locker(lock());
-    _free_set->rebuild();
+    {
+      ShenandoahGCPhase phase(concurrent ? ShenandoahPhaseTimings::final_rebuild_freeset_scan :
+                                           ShenandoahPhaseTimings::degen_gc_final_rebuild_freeset_scan);
+      _free_set->prepare_to_rebuild();
+    }
+    {
+      ShenandoahGCPhase phase(concurrent ? ShenandoahPhaseTimings::final_rebuild_freeset_reserve :
+                                           ShenandoahPhaseTimings::degen_gc_final_rebuild_freeset_reserve);
+      _free_set->finish_rebuild();
+    }
   }
 }
 
@@ -2219,7 +2338,18 @@ void ShenandoahHeap::rebuild_free_set(bool concurrent) {
                             ShenandoahPhaseTimings::final_update_refs_rebuild_freeset :
                             ShenandoahPhaseTimings::degen_gc_final_update_refs_rebuild_freeset);
     ShenandoahHeapLocker locker(lock());
-    _free_set->rebuild();
+    {
+      ShenandoahGCPhase phase(concurrent ?
+                              ShenandoahPhaseTimings::final_update_refs_freeset_scan :
+                              ShenandoahPhaseTimings::degen_gc_update_refs_freeset_scan);
+      _free_set->prepare_to_rebuild();
+    }
+    {
+      ShenandoahGCPhase phase(concurrent ?
+                              ShenandoahPhaseTimings::final_update_refs_freeset_reserve :
+                              ShenandoahPhaseTimings::degen_gc_update_refs_freeset_reserve);
+      _free_set->finish_rebuild();
+    }
   }
 }
 
@@ -216,6 +216,10 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   void set_forced_counters_update(bool value);
   void handle_force_counters_update();
 
+  // Publish the CPU time of the GC threads to the CPUTimeCounters.  Only
+  // called by the control thread, at the end of each GC cycle.
+  void update_gc_threads_cpu_time();
+
 // ---------- Workers handling
 //
 private:
@@ -554,6 +558,11 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
                                                size_t size,
                                                Metaspace::MetadataType mdtype) override;
 
+  // Support for loading objects from CDS archive into the heap
+  bool can_load_archived_objects() const override { return UseCompressedOops; }
+  HeapWord* allocate_loaded_archive_space(size_t size) override;
+  void complete_loaded_archive_space(MemRegion archive_space) override;
+
   void notify_mutator_alloc_words(size_t words, bool waste);
 
   HeapWord* allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size) override;
@@ -28,6 +28,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -183,6 +185,8 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_epoch_alloc_words, (size_t)0);
+  Atomic::store(&_epoch_allocators, (size_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -223,6 +227,22 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+size_t ShenandoahPacer::record_alloc(JavaThread* thread, intptr_t epoch, size_t words) {
+  if (!ShenandoahThreadLocalData::is_pacing_epoch(thread, epoch)) {
+    Atomic::inc(&_epoch_allocators, memory_order_relaxed);
+  }
+  Atomic::add(&_epoch_alloc_words, words, memory_order_relaxed);
+  return ShenandoahThreadLocalData::add_pacing_alloc_words(thread, epoch, words);
+}
+
+size_t ShenandoahPacer::fair_share_words() const {
+  const size_t allocators = Atomic::load(&_epoch_allocators);
+  if (allocators == 0) {
+    return 0;
+  }
+  return Atomic::load(&_epoch_alloc_words) / allocators;
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -232,6 +252,15 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     return;
   }
 
+  // Only allocations that depleted the budget are recorded for the fair
+  // share, which keeps the fast path free of additional atomics. These are
+  // the allocations competing for the GC progress.
+  JavaThread* const current = JavaThread::current();
+  size_t thread_words = 0;
+  if (ShenandoahPacingFairness) {
+    thread_words = record_alloc(current, Atomic::load(&_epoch), words);
+  }
+
   // Forcefully claim the budget: it may go negative at this point, and
   // GC should replenish for this and subsequent allocations. After this claim,
   // we would wait a bit until our claim is matched by additional progress,
@@ -246,17 +275,25 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Thread which is not an active Java thread should also not block.
   // This can happen during VM init when main thread is still not an
   // active Java thread.
-  JavaThread* current = JavaThread::current();
   if (current->is_attaching_via_jni() ||
       !current->is_active_Java_thread()) {
     return;
   }
 
+  EventShenandoahAllocationPacing event;
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
   size_t total_ms = 0;
 
+  // Threads allocating less than the fair share in this epoch are not the
+  // ones outpacing the GC. Let them wait only in proportion to their share.
+  const size_t fair_share = ShenandoahPacingFairness ? fair_share_words() : 0;
+  const bool heavy_allocator = thread_words >= fair_share;
+  if (!heavy_allocator) {
+    max_ms = MAX2<size_t>(1, (size_t)(max_ms * ((double)thread_words / fair_share)));
+  }
+
   while (true) {
     // We could instead assist GC, but this would suffice for now.
     size_t cur_ms = (max_ms > total_ms) ? (max_ms - total_ms) : 1;
@@ -271,7 +308,15 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     Breaking out and allocating anyway, which may mean we outpace GC,
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
-      ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      if (event.should_commit()) {
+        event.set_allocationSize(words * HeapWordSize);
+        event.set_threadAllocated(thread_words * HeapWordSize);
+        event.set_fairShare(fair_share * HeapWordSize);
+        event.set_heavyAllocator(heavy_allocator);
+        event.set_maxDelay(max_ms);
+        event.commit();
+      }
+      ShenandoahThreadLocalData::add_paced_time(current, end - start);
       break;
     }
   }
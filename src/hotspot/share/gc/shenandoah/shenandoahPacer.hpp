@@ -31,6 +31,7 @@
 #include "memory/allocation.hpp"
 #include "runtime/task.hpp"
 
+class JavaThread;
 class ShenandoahHeap;
 class ShenandoahPacer;
 
@@ -56,6 +57,12 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahPacingFairness, the pacer also tracks how much each thread has
+ * allocated in the current epoch while the budget was depleted. Threads that
+ * allocated less than the fair share, i.e. the average over all such threads,
+ * stall proportionally shorter, so that the pacing delay is mostly paid by the
+ * threads driving the allocation.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -80,6 +87,11 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Allocations in the current epoch, to determine the fair share per thread
+  volatile size_t _epoch_alloc_words;
+  volatile size_t _epoch_allocators;
+  shenandoah_padding(4);
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -90,7 +102,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _epoch_alloc_words(0),
+          _epoch_allocators(0) {
     _notify_waiters_task.enroll();
   }
 
@@ -127,6 +141,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   size_t update_and_get_progress_history();
 
+  size_t record_alloc(JavaThread* thread, intptr_t epoch, size_t words);
+  size_t fair_share_words() const;
+
   void wait(size_t time_ms);
 };
 
@@ -70,6 +70,8 @@ class outputStream;
   f(final_manage_labs,                              "  Manage GC/TLABs")               \
   f(choose_cset,                                    "  Choose Collection Set")         \
   f(final_rebuild_freeset,                          "  Rebuild Free Set")              \
+  f(final_rebuild_freeset_scan,                     "    Scan Regions")                \
+  f(final_rebuild_freeset_reserve,                  "    Evacuation Reserve")          \
   f(init_evac,                                      "  Initial Evacuation")            \
   SHENANDOAH_PAR_PHASE_DO(evac_,                    "    E: ", f)                      \
                                                                                        \
@@ -112,6 +114,8 @@ class outputStream;
   f(final_update_refs_update_region_states,         "  Update Region States")          \
   f(final_update_refs_trash_cset,                   "  Trash Collection Set")          \
   f(final_update_refs_rebuild_freeset,              "  Rebuild Free Set")              \
+  f(final_update_refs_freeset_scan,                 "    Scan Regions")                \
+  f(final_update_refs_freeset_reserve,              "    Evacuation Reserve")          \
                                                                                        \
   f(conc_cleanup_complete,                          "Concurrent Cleanup")              \
                                                                                        \
@@ -133,6 +137,8 @@ class outputStream;
   f(degen_gc_final_manage_labs,                     "  Manage GC/TLABs")               \
   f(degen_gc_choose_cset,                           "  Choose Collection Set")         \
   f(degen_gc_final_rebuild_freeset,                 "  Rebuild Free Set")              \
+  f(degen_gc_final_rebuild_freeset_scan,            "    Scan Regions")                \
+  f(degen_gc_final_rebuild_freeset_reserve,         "    Evacuation Reserve")          \
   f(degen_gc_stw_evac,                              "  Evacuation")                    \
   f(degen_gc_init_update_refs_manage_gclabs,        "  Manage GCLABs")                 \
   f(degen_gc_updaterefs,                            "  Update References")             \
@@ -140,6 +146,8 @@ class outputStream;
   f(degen_gc_final_update_refs_update_region_states,"  Update Region States")          \
   f(degen_gc_final_update_refs_trash_cset,          "  Trash Collection Set")          \
   f(degen_gc_final_update_refs_rebuild_freeset,     "  Rebuild Free Set")              \
+  f(degen_gc_update_refs_freeset_scan,              "    Scan Regions")                \
+  f(degen_gc_update_refs_freeset_reserve,           "    Evacuation Reserve")          \
   f(degen_gc_update_roots,                          "  Degen Update Roots")            \
   SHENANDOAH_PAR_PHASE_DO(degen_gc_update_,         "    DU: ", f)                     \
   f(degen_gc_cleanup_complete,                      "  Cleanup")                       \
@@ -45,6 +45,9 @@ class ShenandoahThreadLocalData {
   PLAB* _gclab;
   size_t _gclab_size;
   double _paced_time;
+  // Words allocated in the current pacing epoch
+  intptr_t _pacing_epoch;
+  size_t _pacing_alloc_words;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -53,7 +56,9 @@ class ShenandoahThreadLocalData {
     _satb_mark_queue(&ShenandoahBarrierSet::satb_mark_queue_set()),
     _gclab(nullptr),
     _gclab_size(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _pacing_epoch(0),
+    _pacing_alloc_words(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -124,6 +129,22 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  static bool is_pacing_epoch(Thread* thread, intptr_t epoch) {
+    return data(thread)->_pacing_epoch == epoch;
+  }
+
+  // Returns the words allocated by the thread in the given pacing epoch,
+  // including the new allocation.
+  static size_t add_pacing_alloc_words(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    if (d->_pacing_epoch != epoch) {
+      d->_pacing_epoch = epoch;
+      d->_pacing_alloc_words = 0;
+    }
+    d->_pacing_alloc_words += words;
+    return d->_pacing_alloc_words;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
@@ -246,6 +246,12 @@
           "GC effectively stall the threads indefinitely instead of going " \
           "to degenerated or Full GC.")                                     \
                                                                             \
+  product(bool, ShenandoahPacingFairness, false, EXPERIMENTAL,              \
+          "Scale the pacing delay of a thread by its share of the "         \
+          "allocations paced in the current pacing phase. Threads "         \
+          "allocating less than the average of all paced threads are "      \
+          "delayed proportionally less than ShenandoahPacingMaxDelay.")     \
+                                                                            \
   product(uintx, ShenandoahPacingIdleSlack, 2, EXPERIMENTAL,                \
           "How much of heap counted as non-taxable allocations during idle "\
           "phases. Larger value makes the pacing milder when collector is " \
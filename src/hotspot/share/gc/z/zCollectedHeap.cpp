@@ -49,6 +49,8 @@
 #include "memory/universe.hpp"
 #include "oops/stackChunkOop.hpp"
 #include "runtime/continuationJavaClasses.hpp"
+#include "runtime/cpuTimeCounters.hpp"
+#include "runtime/init.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "services/memoryUsage.hpp"
@@ -83,6 +85,9 @@ jint ZCollectedHeap::initialize() {
 
   Universe::set_verify_data(~(ZAddressHeapBase - 1) | 0x7, ZAddressHeapBase);
 
+  CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+  CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_service);
+
   return JNI_OK;
 }
 
@@ -309,6 +314,34 @@ WorkerThreads* ZCollectedHeap::safepoint_workers() {
   return _runtime_workers.workers();
 }
 
+void ZCollectedHeap::update_gc_threads_cpu_time() {
+  assert(Thread::current() == _stat, "Must be called from statistics thread");
+  // The counters are created during heap initialization, which may still be
+  // in progress when the statistics thread starts sampling.
+  if (!UsePerfData || !os::is_thread_cpu_time_supported() || !is_init_completed()) {
+    return;
+  }
+
+  // Ensure ThreadTotalCPUTimeClosure destructors are called before
+  // publishing gc time.
+  {
+    // The worker threads never terminate, so it is safe to read their CPU
+    // times.
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+    _heap.threads_do(&tttc);
+    _runtime_workers.threads_do(&tttc);
+  }
+  {
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::gc_service);
+    tttc.do_thread(_director);
+    tttc.do_thread(_driver_major);
+    tttc.do_thread(_driver_minor);
+    tttc.do_thread(_stat);
+  }
+
+  CPUTimeCounters::publish_gc_total_cpu_time();
+}
+
 void ZCollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   tc->do_thread(_director);
   tc->do_thread(_driver_major);
@@ -105,6 +105,10 @@ class ZCollectedHeap : public CollectedHeap {
 
   void gc_threads_do(ThreadClosure* tc) const override;
 
+  // Publish the CPU time of the GC threads to the CPUTimeCounters.  Only
+  // called by the statistics thread, once per sample.
+  void update_gc_threads_cpu_time();
+
   VirtualSpaceSummary create_heap_space_summary() override;
 
   bool contains_null(const oop* p) const override;
@@ -32,6 +32,8 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "utilities/numberSeq.hpp"
 
 ZDirector* ZDirector::_director;
 
@@ -55,12 +57,19 @@ struct ZDirectorGenerationGeneralStats {
   uint   _total_collections_at_start;
 };
 
+struct ZDirectorAllocRateStats {
+  double _avg;
+  double _sd;
+  double _burst_avg;
+};
+
 struct ZDirectorGenerationStats {
   ZStatCycleStats                 _cycle;
   ZStatWorkersStats               _workers;
   ZWorkerResizeStats              _resize;
   ZStatHeapStats                  _stat_heap;
   ZDirectorGenerationGeneralStats _general;
+  ZDirectorAllocRateStats         _alloc_rate;
 };
 
 struct ZDirectorStats {
@@ -70,6 +79,55 @@ struct ZDirectorStats {
   ZDirectorGenerationStats   _old_stats;
 };
 
+// Forecasts the rate at which the used memory of a generation grows, which
+// is the mutator allocation rate for young and the promotion rate for old.
+// Samples are taken from the director thread at most once per decision
+// interval, allowing short allocation bursts to be told apart from the long
+// term rate. Intervals in which the generation shrinks, because memory was
+// reclaimed, are not sampled.
+class ZDirectorAllocRateForecast {
+private:
+  static const uint burst_samples = 10;
+  static const uint long_term_samples = 1000;
+
+  jlong        _last_sample_time;
+  size_t       _last_used;
+  TruncatedSeq _burst_rate;
+  TruncatedSeq _rate;
+
+public:
+  ZDirectorAllocRateForecast()
+    : _last_sample_time(0),
+      _last_used(0),
+      _burst_rate(burst_samples),
+      _rate(long_term_samples) {}
+
+  void sample(size_t used, uint64_t decision_hz) {
+    const jlong now = os::elapsed_counter();
+    const double elapsed_seconds = double(now - _last_sample_time) / os::elapsed_frequency();
+    if (_last_sample_time != 0 && elapsed_seconds < 1.0 / decision_hz) {
+      // Too short interval to sample
+      return;
+    }
+
+    if (_last_sample_time != 0 && used >= _last_used) {
+      const double bytes_per_second = double(used - _last_used) / elapsed_seconds;
+      _burst_rate.add(bytes_per_second);
+      _rate.add(bytes_per_second);
+    }
+
+    _last_sample_time = now;
+    _last_used = used;
+  }
+
+  ZDirectorAllocRateStats stats() const {
+    return {_rate.avg(), _rate.sd(), _burst_rate.avg()};
+  }
+};
+
+static ZDirectorAllocRateForecast young_alloc_rate_forecast;
+static ZDirectorAllocRateForecast old_alloc_rate_forecast;
+
 ZDirector::ZDirector()
   : _monitor(),
     _stopped(false) {
@@ -361,6 +419,83 @@ static bool rule_minor_allocation_rate(const ZDirectorStats& stats) {
   return rule_minor_allocation_rate_static(stats);
 }
 
+static double young_gc_duration(const ZDirectorStats& stats) {
+  const ZStatCycleStats& cycle = stats._young_stats._cycle;
+  const double gc_workers = MAX2(cycle._last_active_workers, 1.0);
+  return cycle._avg_serial_time + (cycle._avg_parallelizable_time / gc_workers);
+}
+
+// Estimate the probability that the combined growth of both generations
+// exhausts the free memory before a young collection started now completes.
+// The growth rates of the generations are modelled as independent normal
+// distributions, centered at the larger of their recent burst rate and their
+// long term average.
+static double predict_stall_risk(const ZDirectorStats& stats, double* time_until_oom) {
+  const size_t soft_max_capacity = stats._heap._soft_max_heap_size;
+  const size_t used = stats._heap._used;
+  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
+  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+
+  const ZDirectorAllocRateStats& young = stats._young_stats._alloc_rate;
+  const ZDirectorAllocRateStats& old = stats._old_stats._alloc_rate;
+  const double rate_avg = MAX2(young._avg, young._burst_avg) + MAX2(old._avg, old._burst_avg);
+  const double rate_sd = sqrt((young._sd * young._sd) + (old._sd * old._sd));
+
+  *time_until_oom = free / (rate_avg + 1.0); // Plus 1.0B/s to avoid division by zero
+
+  const double gc_duration = young_gc_duration(stats);
+  if (gc_duration <= 0.0) {
+    return 0.0;
+  }
+
+  const double stall_rate = free / gc_duration;
+  if (rate_sd <= 0.0) {
+    return rate_avg >= stall_rate ? 1.0 : 0.0;
+  }
+
+  return 0.5 * erfc((stall_rate - rate_avg) / (rate_sd * M_SQRT2));
+}
+
+static bool rule_minor_allocation_burst(const ZDirectorStats& stats) {
+  if (ZCollectionIntervalOnly || ZStallRiskLimit >= 1.0) {
+    // Rule disabled
+    return false;
+  }
+
+  if (!stats._old_stats._cycle._is_time_trustable) {
+    // Rule disabled
+    return false;
+  }
+
+  if (ZHeap::heap()->is_alloc_stalling_for_old()) {
+    // Don't collect young if we have threads stalled waiting for an old collection
+    return false;
+  }
+
+  if (is_young_small(stats)) {
+    return false;
+  }
+
+  // Perform GC if an allocation burst makes it likely that we run out of
+  // memory before a young collection could complete. The allocation rate
+  // rules are based on the mutator allocation rate, which is sampled rather
+  // infrequently and smoothed over a long window, so they react late to
+  // bursts of allocations.
+  double time_until_oom;
+  const double stall_risk = predict_stall_risk(stats, &time_until_oom);
+
+  log_debug(gc, director)("Rule Minor: Allocation Burst, BurstAllocRate: %.1fMB/s, AllocRate: %.1fMB/s (+/-%.1fMB/s), "
+                          "TimeUntilOOM: %.3fs, GCDuration: %.3fs, StallRisk: %.2f%%",
+                          stats._young_stats._alloc_rate._burst_avg / M,
+                          stats._young_stats._alloc_rate._avg / M,
+                          stats._young_stats._alloc_rate._sd / M,
+                          time_until_oom,
+                          young_gc_duration(stats),
+                          stall_risk * 100);
+
+  return stall_risk > ZStallRiskLimit;
+}
+
 static bool rule_minor_high_usage(const ZDirectorStats& stats) {
   if (ZCollectionIntervalOnly) {
     // Rule disabled
@@ -609,6 +744,10 @@ static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
     return GCCause::_z_allocation_rate;
   }
 
+  if (rule_minor_allocation_burst(stats)) {
+    return GCCause::_z_allocation_rate;
+  }
+
   if (rule_minor_high_usage(stats)) {
     return GCCause::_z_high_usage;
   }
@@ -780,13 +919,20 @@ static ZWorkerCounts initial_workers(const ZDirectorStats& stats, ZWorkerSelecti
   return select_worker_threads(stats, young_workers, type);
 }
 
+static void record_predicted_stall_risk(const ZDirectorStats& stats) {
+  double time_until_oom;
+  ZStatStallRisk::set_predicted(predict_stall_risk(stats, &time_until_oom));
+}
+
 static void start_major_gc(const ZDirectorStats& stats, GCCause::Cause cause) {
+  record_predicted_stall_risk(stats);
   const ZWorkerCounts selection = initial_workers(stats, ZWorkerSelectionType::start_major);
   const ZDriverRequest request(cause, selection._young_workers, selection._old_workers);
   ZDriver::major()->collect(request);
 }
 
 static void start_minor_gc(const ZDirectorStats& stats, GCCause::Cause cause) {
+  record_predicted_stall_risk(stats);
   const ZWorkerSelectionType type = ZDriver::major()->is_busy()
       ? ZWorkerSelectionType::minor_during_old
       : ZWorkerSelectionType::normal;
@@ -881,6 +1027,11 @@ static ZDirectorStats sample_stats() {
   ZDirectorGenerationGeneralStats young_generation = { ZHeap::heap()->used_young(), 0 };
   ZDirectorGenerationGeneralStats old_generation = { ZHeap::heap()->used_old(), old->total_collections_at_start() };
 
+  young_alloc_rate_forecast.sample(young_generation._used, ZDirector::decision_hz);
+  old_alloc_rate_forecast.sample(old_generation._used, ZDirector::decision_hz);
+  ZDirectorAllocRateStats young_alloc_rate = young_alloc_rate_forecast.stats();
+  ZDirectorAllocRateStats old_alloc_rate = old_alloc_rate_forecast.stats();
+
   return {
     mutator_alloc_rate,
     heap,
@@ -889,14 +1040,16 @@ static ZDirectorStats sample_stats() {
       young_workers,
       young_resize,
       young_stat_heap,
-      young_generation
+      young_generation,
+      young_alloc_rate
     },
     {
       old_cycle,
       old_workers,
       old_resize,
       old_stat_heap,
-      old_generation
+      old_generation,
+      old_alloc_rate
     }
   };
 }
@@ -28,8 +28,10 @@
 #include "gc/z/zThread.hpp"
 
 class ZDirector : public ZThread {
-private:
+public:
   static const uint64_t decision_hz = 100;
+
+private:
   static ZDirector* _director;
 
   ZConditionLock _monitor;
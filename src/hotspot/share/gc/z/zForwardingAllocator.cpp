@@ -23,18 +23,68 @@
 
 #include "precompiled.hpp"
 #include "gc/z/zForwardingAllocator.hpp"
-#include "memory/allocation.inline.hpp"
+#include "nmt/memTracker.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#include "utilities/debug.hpp"
 
 ZForwardingAllocator::ZForwardingAllocator()
   : _start(nullptr),
     _end(nullptr),
-    _top(nullptr) {}
+    _top(nullptr),
+    _reserved(0) {}
 
 ZForwardingAllocator::~ZForwardingAllocator() {
-  FREE_C_HEAP_ARRAY(char, _start);
+  release();
+}
+
+size_t ZForwardingAllocator::granule_size(size_t size) {
+  // Large pages are only requested through the alignment hint when
+  // committing, which has an effect only if large pages can be committed
+  // on demand (transparent huge pages on Linux). Explicit large pages
+  // would have to be reserved up front, and are not used. Only use large
+  // pages when the allocation covers at least one of them, to not waste
+  // memory on small relocation sets.
+  if (UseLargePages && os::can_commit_large_page_memory() && size >= os::large_page_size()) {
+    return os::large_page_size();
+  }
+
+  return os::vm_page_size();
+}
+
+void ZForwardingAllocator::release() {
+  if (_start != nullptr) {
+    os::release_memory(_start, _reserved);
+    _start = _end = _top = nullptr;
+    _reserved = 0;
+  }
 }
 
 void ZForwardingAllocator::reset(size_t size) {
-  _start = _top = REALLOC_C_HEAP_ARRAY(char, _start, size, mtGC);
+  const size_t granule = granule_size(size);
+  const size_t reserve_size = align_up(MAX2(size, (size_t)1), granule);
+
+  // Replace the mapping if it is too small, or so much larger than needed
+  // that keeping it would hold on to memory after a spike in relocation.
+  if (reserve_size > _reserved || reserve_size < _reserved / 4) {
+    release();
+
+    char* const addr = os::reserve_memory_aligned(reserve_size, granule, !ExecMem);
+    if (addr == nullptr) {
+      vm_exit_out_of_memory(reserve_size, OOM_MMAP_ERROR, "Forwarding table");
+    }
+    MemTracker::record_virtual_memory_type(addr, mtGC);
+
+    // Committing with the granule as alignment hint madvises the mapping
+    // for transparent huge pages. This is only a hint, the kernel may still
+    // back (parts of) the mapping with small pages.
+    os::commit_memory_or_exit(addr, reserve_size, granule, !ExecMem, "Forwarding table");
+
+    _start = addr;
+    _reserved = reserve_size;
+  }
+
+  _top = _start;
   _end = _start + size;
 }
@@ -26,11 +26,20 @@
 
 #include "utilities/globalDefinitions.hpp"
 
+// Bump pointer allocator for the relocation set, its forwardings and their
+// forwarding entries. The memory is mapped directly rather than taken from
+// the C heap, so that large relocation sets can be backed by large pages,
+// and is reused across collections as long as the size requirements stay
+// roughly the same.
 class ZForwardingAllocator {
 private:
-  char* _start;
-  char* _end;
-  char* _top;
+  char*  _start;
+  char*  _end;
+  char*  _top;
+  size_t _reserved;
+
+  static size_t granule_size(size_t size);
+  void release();
 
 public:
   ZForwardingAllocator();
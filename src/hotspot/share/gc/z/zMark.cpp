@@ -394,7 +394,7 @@ void ZMark::follow_object(oop obj, bool finalizable) {
   }
 }
 
-static void try_deduplicate(ZMarkContext* context, oop obj) {
+static void try_deduplicate(ZMarkContext* context, ZPage* page, oop obj) {
   if (!StringDedup::is_enabled()) {
     // Not enabled
     return;
@@ -405,6 +405,12 @@ static void try_deduplicate(ZMarkContext* context, oop obj) {
     return;
   }
 
+  if (StringDedup::is_below_threshold_age(static_cast<uint>(page->age()))) {
+    // Not yet survived enough young collections. Checked before setting the
+    // requested bit, so the String can be requested once it is old enough.
+    return;
+  }
+
   if (java_lang_String::test_and_set_deduplication_requested(obj)) {
     // Already requested deduplication
     return;
@@ -458,7 +464,7 @@ void ZMark::mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry) {
       follow_object(obj, finalizable);
 
       // Try deduplicate
-      try_deduplicate(context, obj);
+      try_deduplicate(context, page, obj);
     }
   }
 }
@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -1086,16 +1087,20 @@ class ZRelocateStoreBufferInstallBasePointersTask : public ZTask {
 
 class ZRelocateTask : public ZRestartableTask {
 private:
-  ZRelocationSetParallelIterator _iter;
-  ZGeneration* const             _generation;
-  ZRelocateQueue* const          _queue;
-  ZRelocateSmallAllocator        _small_allocator;
-  ZRelocateMediumAllocator       _medium_allocator;
+  ZRelocationSetParallelIterator     _iter;
+  ZRelocationSetNUMAParallelIterator _numa_iter;
+  const bool                         _numa_affinity;
+  ZGeneration* const                 _generation;
+  ZRelocateQueue* const              _queue;
+  ZRelocateSmallAllocator            _small_allocator;
+  ZRelocateMediumAllocator           _medium_allocator;
 
 public:
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
     : ZRestartableTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_iter(relocation_set),
+      _numa_affinity(ZNUMARelocationAffinity && ZNUMA::count() > 1),
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
@@ -1139,6 +1144,14 @@ class ZRelocateTask : public ZRestartableTask {
     const auto do_forwarding_one_from_iter = [&]() {
       ZForwarding* forwarding;
 
+      // Prefer pages located on the NUMA node of this worker, so that objects
+      // are copied within the node. Remaining pages are picked up from the
+      // shared iterator once the local ones have been handed out.
+      if (_numa_affinity && _numa_iter.next(&forwarding)) {
+        claim_and_do_forwarding(forwarding);
+        return true;
+      }
+
       if (_iter.next(&forwarding)) {
         claim_and_do_forwarding(forwarding);
         return true;
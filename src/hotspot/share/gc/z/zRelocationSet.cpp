@@ -27,6 +27,7 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -144,7 +145,9 @@ ZRelocationSet::ZRelocationSet(ZGeneration* generation)
     _nforwardings(0),
     _promotion_lock(),
     _flip_promoted_pages(),
-    _in_place_relocate_promoted_pages() {}
+    _in_place_relocate_promoted_pages(),
+    _numa_forwardings(),
+    _numa_offsets() {}
 
 ZWorkers* ZRelocationSet::workers() const {
   return _generation->workers();
@@ -166,10 +169,43 @@ void ZRelocationSet::install(const ZRelocationSetSelector* selector) {
   _forwardings = task.forwardings();
   _nforwardings = task.nforwardings();
 
+  install_numa_forwardings();
+
   // Update statistics
   _generation->stat_relocation()->at_install_relocation_set(_allocator.size());
 }
 
+void ZRelocationSet::install_numa_forwardings() {
+  if (!ZNUMARelocationAffinity || ZNUMA::count() == 1 || _nforwardings == 0) {
+    return;
+  }
+
+  // Bucket the forwardings by the NUMA node of their page, so that the NUMA
+  // parallel iterator only needs one cursor range per node.
+  const int numa_count = (int)ZNUMA::count();
+  _numa_offsets.at_put_grow(numa_count, 0, 0);
+  for (size_t i = 0; i < _nforwardings; i++) {
+    const int numa_id = (int)_forwardings[i]->page()->numa_id();
+    _numa_offsets.at_put(numa_id + 1, _numa_offsets.at(numa_id + 1) + 1);
+  }
+  for (int i = 1; i <= numa_count; i++) {
+    _numa_offsets.at_put(i, _numa_offsets.at(i) + _numa_offsets.at(i - 1));
+  }
+
+  ZArray<size_t> next(numa_count);
+  for (int i = 0; i < numa_count; i++) {
+    next.append(_numa_offsets.at(i));
+  }
+
+  _numa_forwardings.at_put_grow((int)_nforwardings - 1, nullptr, nullptr);
+  for (size_t i = 0; i < _nforwardings; i++) {
+    const int numa_id = (int)_forwardings[i]->page()->numa_id();
+    const size_t index = next.at(numa_id);
+    next.at_put(numa_id, index + 1);
+    _numa_forwardings.at_put((int)index, _forwardings[i]);
+  }
+}
+
 static void destroy_and_clear(ZPageAllocator* page_allocator, ZArray<ZPage*>* array) {
   for (int i = 0; i < array->length(); i++) {
     // Delete non-relocating promoted pages from last cycle
@@ -187,6 +223,8 @@ void ZRelocationSet::reset(ZPageAllocator* page_allocator) {
   }
 
   _nforwardings = 0;
+  _numa_forwardings.clear();
+  _numa_offsets.clear();
 
   destroy_and_clear(page_allocator, &_in_place_relocate_promoted_pages);
   destroy_and_clear(page_allocator, &_flip_promoted_pages);
@@ -26,6 +26,7 @@
 
 #include "gc/z/zArray.hpp"
 #include "gc/z/zForwardingAllocator.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.hpp"
 
 class ZForwarding;
@@ -37,6 +38,7 @@ class ZWorkers;
 
 class ZRelocationSet {
   template <bool> friend class ZRelocationSetIteratorImpl;
+  friend class ZRelocationSetNUMAParallelIterator;
 
 private:
   ZGeneration*         _generation;
@@ -46,8 +48,11 @@ class ZRelocationSet {
   ZLock                _promotion_lock;
   ZArray<ZPage*>       _flip_promoted_pages;
   ZArray<ZPage*>       _in_place_relocate_promoted_pages;
+  ZArray<ZForwarding*> _numa_forwardings;
+  ZArray<size_t>       _numa_offsets;
 
   ZWorkers* workers() const;
+  void install_numa_forwardings();
 
 public:
   ZRelocationSet(ZGeneration* generation);
@@ -70,4 +75,25 @@ class ZRelocationSetIteratorImpl : public ZArrayIteratorImpl<ZForwarding*, Paral
 using ZRelocationSetIterator = ZRelocationSetIteratorImpl<false /* Parallel */>;
 using ZRelocationSetParallelIterator = ZRelocationSetIteratorImpl<true /* Parallel */>;
 
+// Parallel iterator only handing out forwardings of pages located on the
+// NUMA node of the calling thread. Each node has its own cursor, so all
+// forwardings must still be visited through one of the iterators above.
+class ZRelocationSetNUMAParallelIterator : public StackObj {
+private:
+  struct Cursor {
+    volatile size_t _next;
+    size_t          _end;
+    uint8_t         _pad[ZCacheLineSize - 2 * sizeof(size_t)];
+  };
+
+  const ZArray<ZForwarding*>* const _forwardings;
+  Cursor* const                     _cursors;
+
+public:
+  ZRelocationSetNUMAParallelIterator(ZRelocationSet* relocation_set);
+  ~ZRelocationSetNUMAParallelIterator();
+
+  bool next(ZForwarding** forwarding);
+};
+
 #endif // SHARE_GC_Z_ZRELOCATIONSET_HPP
@@ -27,9 +27,44 @@
 #include "gc/z/zRelocationSet.hpp"
 
 #include "gc/z/zArray.inline.hpp"
+#include "gc/z/zNUMA.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 
 template <bool Parallel>
 inline ZRelocationSetIteratorImpl<Parallel>::ZRelocationSetIteratorImpl(ZRelocationSet* relocation_set)
   : ZArrayIteratorImpl<ZForwarding*, Parallel>(relocation_set->_forwardings, relocation_set->_nforwardings) {}
 
+inline ZRelocationSetNUMAParallelIterator::ZRelocationSetNUMAParallelIterator(ZRelocationSet* relocation_set)
+  : _forwardings(&relocation_set->_numa_forwardings),
+    _cursors(NEW_C_HEAP_ARRAY(Cursor, ZNUMA::count(), mtGC)) {
+  // The forwardings were bucketed by NUMA node when the relocation set was
+  // installed. Without buckets, all cursors start out empty.
+  const bool bucketed = relocation_set->_numa_offsets.length() > (int)ZNUMA::count();
+  for (uint32_t i = 0; i < ZNUMA::count(); i++) {
+    _cursors[i]._next = bucketed ? relocation_set->_numa_offsets.at(i) : 0;
+    _cursors[i]._end = bucketed ? relocation_set->_numa_offsets.at(i + 1) : 0;
+  }
+}
+
+inline ZRelocationSetNUMAParallelIterator::~ZRelocationSetNUMAParallelIterator() {
+  FREE_C_HEAP_ARRAY(Cursor, _cursors);
+}
+
+inline bool ZRelocationSetNUMAParallelIterator::next(ZForwarding** forwarding) {
+  Cursor* const cursor = &_cursors[ZNUMA::id()];
+
+  if (Atomic::load(&cursor->_next) >= cursor->_end) {
+    return false;
+  }
+
+  const size_t index = Atomic::fetch_then_add(&cursor->_next, 1u, memory_order_relaxed);
+  if (index >= cursor->_end) {
+    return false;
+  }
+
+  *forwarding = _forwardings->at(int(index));
+  return true;
+}
+
 #endif // SHARE_GC_Z_ZRELOCATIONSET_INLINE_HPP
@@ -723,6 +723,14 @@ void ZStatPhaseGeneration::register_end(ConcurrentGCTimer* timer, const Ticks& s
   ZGeneration* const generation = ZGeneration::generation(_id);
 
   generation->stat_heap()->print_stalls();
+  if (generation->is_young()) {
+    const ZStatHeap* const stat_heap = generation->stat_heap();
+    ZStatStallRisk::at_young_collection_end(MAX4(stat_heap->stalls_at_mark_start(),
+                                                 stat_heap->stalls_at_mark_end(),
+                                                 stat_heap->stalls_at_relocate_start(),
+                                                 stat_heap->stalls_at_relocate_end()));
+    ZStatStallRisk::print();
+  }
   ZStatLoad::print();
   ZStatMMU::print();
   generation->stat_mark()->print();
@@ -1011,6 +1019,32 @@ ZStatMutatorAllocRateStats ZStatMutatorAllocRate::stats() {
   return {_rate.avg(), _rate.predict_next(), _rate.sd()};
 }
 
+//
+// Stat allocation stall risk
+//
+volatile double ZStatStallRisk::_predicted;
+TruncatedSeq    ZStatStallRisk::_predicted_history(100);
+TruncatedSeq    ZStatStallRisk::_observed_history(100);
+
+void ZStatStallRisk::set_predicted(double risk) {
+  Atomic::store(&_predicted, risk);
+}
+
+void ZStatStallRisk::at_young_collection_end(size_t allocation_stalls) {
+  // The number of stalled allocations is only sampled at the phase changes of
+  // the collection, so the observed risk is the fraction of young collections
+  // in which stalls were seen at any of those points.
+  _predicted_history.add(Atomic::load(&_predicted));
+  _observed_history.add(allocation_stalls > 0 ? 1.0 : 0.0);
+}
+
+void ZStatStallRisk::print() {
+  log_debug(gc, alloc)("Allocation Stall Risk: Predicted: %.1f%% (Avg: %.1f%%), Observed: %.1f%%",
+                       _predicted_history.last() * 100,
+                       _predicted_history.avg() * 100,
+                       _observed_history.avg() * 100);
+}
+
 //
 // Stat thread
 //
@@ -1071,6 +1105,7 @@ void ZStat::run_thread() {
   // Main loop
   while (_metronome.wait_for_tick()) {
     sample_and_collect(history);
+    ZCollectedHeap::heap()->update_gc_threads_cpu_time();
     if (should_print(log)) {
       print(log, history);
     }
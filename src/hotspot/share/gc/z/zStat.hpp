@@ -378,6 +378,25 @@ class ZStatMutatorAllocRate : public AllStatic {
   static ZStatMutatorAllocRateStats stats();
 };
 
+//
+// Stat allocation stall risk
+//
+class ZStatStallRisk : public AllStatic {
+private:
+  static volatile double _predicted;
+  static TruncatedSeq    _predicted_history;
+  static TruncatedSeq    _observed_history;
+
+public:
+  // Record the stall risk predicted when a young collection is started
+  static void set_predicted(double risk);
+
+  // Compare the predicted stall risk with the stalls observed during the
+  // young collection that has ended
+  static void at_young_collection_end(size_t allocation_stalls);
+  static void print();
+};
+
 //
 // Stat thread
 //
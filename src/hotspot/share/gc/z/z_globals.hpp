@@ -46,6 +46,12 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(double, ZStallRiskLimit, 1.0, EXPERIMENTAL,                       \
+          "Start a minor collection early when the predicted probability "  \
+          "of an allocation stall exceeds this limit. A limit of 1.0 "      \
+          "disables the rule")                                              \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
@@ -60,6 +66,13 @@
           "0: Claim tree "                                                  \
           "1: Simple Striped ")                                             \
                                                                             \
+  product(bool, ZNUMAPageCacheSteal, true, DIAGNOSTIC,                      \
+          "Allow allocating cached pages located on remote NUMA nodes")     \
+                                                                            \
+  product(bool, ZNUMARelocationAffinity, true, DIAGNOSTIC,                  \
+          "Let relocation workers prefer pages located on their own NUMA "  \
+          "node")                                                           \
+                                                                            \
   product(bool, ZVerifyRemembered, trueInDebug, DIAGNOSTIC,                 \
           "Verify remembered sets")                                         \
                                                                             \
@@ -26,6 +26,7 @@
 #include "compiler/compileBroker.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrCompilerQueueUtilization.hpp"
+#include "runtime/timer.hpp"
 
 enum {
     c1_compiler_queue_id = 1,
@@ -41,6 +42,7 @@ struct CompilerQueueEntry {
   GET_COMPILER_THREAD_COUNT get_compiler_thread_count;
   uint64_t added;
   uint64_t removed;
+  jlong wait;
 };
 
 // If current counters are less than previous, we assume the interface has been reset
@@ -55,8 +57,8 @@ static uint64_t rate_per_second(uint64_t current, uint64_t old, const JfrTickspa
 
 void JfrCompilerQueueUtilization::send_events() {
   static CompilerQueueEntry compilerQueueEntries[num_compiler_queues] = {
-    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0},
-    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0}};
+    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0, 0},
+    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0, 0}};
 
   const JfrTicks cur_time = JfrTicks::now();
   static JfrTicks last_sample_instant;
@@ -68,6 +70,9 @@ void JfrCompilerQueueUtilization::send_events() {
       const uint64_t current_removed = entry->compilerQueue->get_total_removed();
       const uint64_t addedRate = rate_per_second(current_added, entry->added, interval);
       const uint64_t removedRate = rate_per_second(current_removed, entry->removed, interval);
+      const jlong current_wait = entry->compilerQueue->get_total_wait();
+      const uint64_t removed = current_removed - entry->removed;
+      const jlong averageWait = removed > 0 ? (jlong)TimeHelper::counter_to_millis((current_wait - entry->wait) / (jlong)removed) : 0;
 
       EventCompilerQueueUtilization event;
       event.set_compiler(entry->compiler_queue_id);
@@ -79,11 +84,14 @@ void JfrCompilerQueueUtilization::send_events() {
       event.set_removedCount(current_removed - entry->removed);
       event.set_totalAddedCount(current_added);
       event.set_totalRemovedCount(current_removed);
+      event.set_averageWaitTime(averageWait);
+      event.set_peakWaitTime((jlong)TimeHelper::counter_to_millis(entry->compilerQueue->get_peak_wait()));
       event.set_compilerThreadCount(entry->get_compiler_thread_count());
       event.commit();
 
       entry->added = current_added;
       entry->removed = current_removed;
+      entry->wait = current_wait;
     }
 
     last_sample_instant = cur_time;
@@ -30,6 +30,17 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ticks.hpp"
 
+size_t JfrNativeMemoryEvent::_last_committed[mt_number_of_types];
+size_t JfrNativeMemoryEvent::_last_total_committed = 0;
+bool JfrNativeMemoryEvent::_has_last_type_events = false;
+bool JfrNativeMemoryEvent::_has_last_total_event = false;
+
+static jlong committed_delta(bool has_last, size_t* last, size_t committed) {
+  const jlong delta = has_last ? (jlong)committed - (jlong)*last : 0;
+  *last = committed;
+  return delta;
+}
+
 static NMTUsage* get_usage(const Ticks& timestamp) {
   static Ticks last_timestamp;
   static NMTUsage* usage = nullptr;
@@ -60,15 +71,19 @@ void JfrNativeMemoryEvent::send_total_event(const Ticks& timestamp) {
   event.set_starttime(timestamp);
   event.set_reserved(usage->total_reserved());
   event.set_committed(usage->total_committed());
+  event.set_committedDelta(committed_delta(_has_last_total_event, &_last_total_committed, usage->total_committed()));
   event.commit();
+  _has_last_total_event = true;
 }
 
-void JfrNativeMemoryEvent::send_type_event(const Ticks& starttime, MEMFLAGS flag, size_t reserved, size_t committed) {
+void JfrNativeMemoryEvent::send_type_event(const Ticks& starttime, MEMFLAGS flag, size_t reserved, size_t committed,
+                                           jlong delta) {
   EventNativeMemoryUsage event(UNTIMED);
   event.set_starttime(starttime);
   event.set_type(NMTUtil::flag_to_index(flag));
   event.set_reserved(reserved);
   event.set_committed(committed);
+  event.set_committedDelta(delta);
   event.commit();
 }
 
@@ -85,6 +100,9 @@ void JfrNativeMemoryEvent::send_type_events(const Ticks& timestamp) {
       // Skip mtNone since it is not really used.
       continue;
     }
-    send_type_event(timestamp, flag, usage->reserved(flag), usage->committed(flag));
+    const size_t committed = usage->committed(flag);
+    send_type_event(timestamp, flag, usage->reserved(flag), committed,
+                    committed_delta(_has_last_type_events, &_last_committed[index], committed));
   }
+  _has_last_type_events = true;
 }
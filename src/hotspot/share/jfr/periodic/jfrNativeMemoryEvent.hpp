@@ -35,7 +35,15 @@
 // so no more synchronization is needed.
 class JfrNativeMemoryEvent : public AllStatic {
 private:
-  static void send_type_event(const Ticks& starttime, MEMFLAGS flag, size_t reserved, size_t committed);
+  // Committed sizes sent with the previous events, so that each event can
+  // also carry the growth since then.
+  static size_t _last_committed[mt_number_of_types];
+  static size_t _last_total_committed;
+  static bool _has_last_type_events;
+  static bool _has_last_total_event;
+
+  static void send_type_event(const Ticks& starttime, MEMFLAGS flag, size_t reserved, size_t committed,
+                              jlong delta);
  public:
   static void send_total_event(const Ticks& timestamp);
   static void send_type_events(const Ticks& timestamp);
@@ -55,6 +55,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/cpuTimeCounters.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -410,6 +411,28 @@ TRACE_REQUEST_FUNC(G1HeapRegionInformation) {
 // long value is undefined.
 static jlong jmc_undefined_long = min_jlong;
 
+TRACE_REQUEST_FUNC(GCThreadGroupCPUTime) {
+  if (!CPUTimeCounters::is_initialized()) {
+    return;
+  }
+  for (int i = 0; i < static_cast<int>(CPUTimeGroups::CPUTimeType::COUNT); i++) {
+    CPUTimeGroups::CPUTimeType type = static_cast<CPUTimeGroups::CPUTimeType>(i);
+    if (type != CPUTimeGroups::CPUTimeType::gc_total &&
+        type != CPUTimeGroups::CPUTimeType::conc_dedup &&
+        !CPUTimeGroups::is_gc_counter(type)) {
+      continue;
+    }
+    PerfCounter* counter = CPUTimeCounters::get_counter(type);
+    if (counter == nullptr) {
+      continue;
+    }
+    EventGCThreadGroupCPUTime event;
+    event.set_group(CPUTimeGroups::to_string(type));
+    event.set_cpuTime(counter->get_value());
+    event.commit();
+  }
+}
+
 TRACE_REQUEST_FUNC(GCConfiguration) {
   GCConfiguration conf;
   jlong pause_target = conf.has_pause_target_default_value() ? jmc_undefined_long : conf.pause_target();
@@ -708,6 +731,7 @@ TRACE_REQUEST_FUNC(CodeCacheConfiguration) {
   event.set_minBlockLength(CodeCacheMinBlockLength);
   event.set_startAddress((u8)CodeCache::low_bound());
   event.set_reservedTopAddress((u8)CodeCache::high_bound());
+  event.set_pageSize(CodeCache::reserved_page_size());
   event.commit();
 }
 
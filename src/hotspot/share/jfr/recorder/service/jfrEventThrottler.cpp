@@ -27,6 +27,7 @@
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 
 constexpr static const JfrSamplerParams _disabled_params = {
                                                              0, // sample points per window
@@ -35,7 +36,9 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+// Throttlers keyed by event id. The jdk.ObjectAllocationSample throttler is
+// created eagerly, throttlers for other events on their first configuration.
+static JfrEventThrottler* _throttlers[LAST_EVENT_ID + 1] = {};
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -47,31 +50,66 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   _disabled(false),
   _update(false) {}
 
+// If the throttler is off, it accepts all events.
+constexpr static const int64_t event_throttler_off = -2;
+
+inline bool is_disabled(int64_t event_sample_size) {
+  return event_sample_size == event_throttler_off;
+}
+
+static bool is_valid_event_id(JfrEventId event_id) {
+  return (unsigned)event_id >= FIRST_EVENT_ID && (unsigned)event_id <= LAST_EVENT_ID;
+}
+
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  assert(_throttlers[JfrObjectAllocationSampleEvent] == nullptr, "invariant");
+  JfrEventThrottler* const throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
+  if (throttler == nullptr || !throttler->initialize()) {
+    delete throttler;
+    return false;
+  }
+  _throttlers[JfrObjectAllocationSampleEvent] = throttler;
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (unsigned i = FIRST_EVENT_ID; i <= LAST_EVENT_ID; ++i) {
+    delete _throttlers[i];
+    _throttlers[i] = nullptr;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  assert(is_valid_event_id(event_id), "invariant");
+  return Atomic::load_acquire(&_throttlers[event_id]);
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (!is_valid_event_id(event_id)) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  JfrEventThrottler* throttler = for_event(event_id);
+  if (throttler == nullptr) {
+    if (is_disabled(sample_size)) {
+      // Nothing to turn off, an event without a throttler accepts all events.
+      return;
+    }
+    throttler = new JfrEventThrottler(event_id);
+    if (throttler == nullptr || !throttler->initialize()) {
+      delete throttler;
+      log_warning(jfr, system, throttle)("Unable to create throttler for event id %u", (unsigned)event_id);
+      return;
+    }
+    // Configure before publishing, a throttler without parameters rejects everything.
+    throttler->configure(sample_size, period_ms);
+    JfrEventThrottler* const prev = Atomic::cmpxchg(&_throttlers[event_id], (JfrEventThrottler*)nullptr, throttler);
+    if (prev == nullptr) {
+      return;
+    }
+    delete throttler;
+    throttler = prev;
+  }
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +132,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -136,9 +174,6 @@ inline void set_low_rate(JfrSamplerParams& params, int64_t event_sample_size, in
   params.window_duration_ms = period_ms;
 }
 
-// If the throttler is off, it accepts all events.
-constexpr static const int64_t event_throttler_off = -2;
-
 /*
  * Set the number of sample points and window duration.
  */
@@ -193,10 +228,6 @@ inline void normalize(int64_t* sample_size, int64_t* period_ms) {
   }
 }
 
-inline bool is_disabled(int64_t event_sample_size) {
-  return event_sample_size == event_throttler_off;
-}
-
 const JfrSamplerParams& JfrEventThrottler::update_params(const JfrSamplerWindow* expired) {
   _disabled = is_disabled(_sample_size);
   if (_disabled) {
@@ -236,20 +267,20 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Excerpt:
  *
- * "jdk.ObjectAllocationSample: avg.sample size: 19.8377, window set point: 20 ..."
+ * "Event id 30: avg.sample size: 19.8377, window set point: 20 ..."
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
  *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
+ * Native code has no map from event id to event name, the id can be looked up
+ * with 'jfr metadata'.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("Event id %u: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      (unsigned)event_id, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
   }
@@ -268,7 +299,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_id, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
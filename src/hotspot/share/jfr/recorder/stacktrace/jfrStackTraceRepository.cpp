@@ -28,6 +28,7 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 
 /*
@@ -40,6 +41,8 @@
 static JfrStackTraceRepository* _instance = nullptr;
 static JfrStackTraceRepository* _leak_profiler_instance = nullptr;
 static traceid _next_id = 0;
+// Incremented whenever stored traces are discarded, invalidating per-thread copies.
+static volatile u4 _generation = 0;
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
   assert(_instance != nullptr, "invariant");
@@ -120,6 +123,7 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (clear) {
     memset(_table, 0, sizeof(_table));
     _entries = 0;
+    Atomic::inc(&_generation);
   }
   _last_entries = _entries;
   return count;
@@ -139,6 +143,7 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
     }
   }
   memset(repo._table, 0, sizeof(repo._table));
+  Atomic::inc(&_generation);
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -167,7 +172,49 @@ traceid JfrStackTraceRepository::record(Thread* current_thread, int skip /* 0 */
 
 traceid JfrStackTraceRepository::record(JavaThread* current_thread, int skip, int64_t stack_filter_id, JfrStackFrame *frames, u4 max_frames) {
   JfrStackTrace stacktrace(frames, max_frames);
-  return stacktrace.record(current_thread, skip, stack_filter_id) ? add(instance(), stacktrace) : 0;
+  if (!stacktrace.record(current_thread, skip, stack_filter_id)) {
+    return 0;
+  }
+  // Threads emitting events at a high rate tend to do so from the same call site.
+  // Compare against the thread's last trace first to avoid the shared table lock.
+  JfrThreadLocal* const tl = current_thread->jfr_thread_local();
+  const u4 generation = Atomic::load_acquire(&_generation);
+  traceid id = lookup_last_stacktrace(tl, stacktrace, generation);
+  if (id == 0) {
+    id = add(instance(), stacktrace);
+    set_last_stacktrace(tl, stacktrace, id, generation);
+  }
+  return id;
+}
+
+traceid JfrStackTraceRepository::lookup_last_stacktrace(const JfrThreadLocal* tl, const JfrStackTrace& stacktrace, u4 generation) {
+  assert(tl != nullptr, "invariant");
+  const JfrStackTrace* const last = tl->last_stacktrace();
+  if (last == nullptr || tl->last_stacktrace_generation() != generation || !last->equals(stacktrace)) {
+    return 0;
+  }
+  return last->id();
+}
+
+void JfrStackTraceRepository::set_last_stacktrace(JfrThreadLocal* tl, const JfrStackTrace& stacktrace, traceid id, u4 generation) {
+  assert(tl != nullptr, "invariant");
+  assert(id != 0, "invariant");
+  JfrStackTrace* last = tl->last_stacktrace();
+  if (last != nullptr && last->_max_frames < stacktrace._nr_of_frames) {
+    delete last;
+    last = nullptr;
+  }
+  if (last == nullptr) {
+    last = new JfrStackTrace(NEW_C_HEAP_ARRAY(JfrStackFrame, stacktrace._max_frames, mtTracing), stacktrace._max_frames);
+    last->_frames_ownership = true;
+    tl->set_last_stacktrace(last);
+  }
+  memcpy(last->_frames, stacktrace._frames, stacktrace._nr_of_frames * sizeof(JfrStackFrame));
+  last->set_id(id);
+  last->_hash = stacktrace._hash;
+  last->set_nr_of_frames(stacktrace._nr_of_frames);
+  last->set_reached_root(stacktrace._reached_root);
+  tl->set_last_stacktrace_generation(generation);
 }
 
 traceid JfrStackTraceRepository::add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
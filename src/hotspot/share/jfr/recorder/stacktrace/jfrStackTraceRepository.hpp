@@ -32,6 +32,7 @@
 class JavaThread;
 class JfrCheckpointWriter;
 class JfrChunkWriter;
+class JfrThreadLocal;
 
 class JfrStackTraceRepository : public JfrCHeapObj {
   friend class JfrDeprecatedEdge;
@@ -71,6 +72,8 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
   traceid record(JavaThread* current_thread, int skip, int64_t stack_filter_id, JfrStackFrame* frames, u4 max_frames);
+  static traceid lookup_last_stacktrace(const JfrThreadLocal* tl, const JfrStackTrace& stacktrace, u4 generation);
+  static void set_last_stacktrace(JfrThreadLocal* tl, const JfrStackTrace& stacktrace, traceid id, u4 generation);
 
  public:
   static traceid record(Thread* current_thread, int skip = 0, int64_t stack_filter_id = -1);
@@ -31,6 +31,7 @@
 #include "jfr/recorder/checkpoint/types/traceid/jfrOopTraceId.inline.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTrace.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/support/jfrThreadId.inline.hpp"
@@ -56,6 +57,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _checkpoint_buffer_epoch_0(nullptr),
   _checkpoint_buffer_epoch_1(nullptr),
   _stackframes(nullptr),
+  _last_stacktrace(nullptr),
   _dcmd_arena(nullptr),
   _thread(),
   _vthread_id(0),
@@ -70,6 +72,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
   _stackdepth(0),
+  _last_stacktrace_generation(0),
   _entering_suspend_flag(0),
   _critical_section(0),
   _vthread_epoch(0),
@@ -162,6 +165,10 @@ void JfrThreadLocal::release(Thread* t) {
     FREE_C_HEAP_ARRAY(JfrStackFrame, _stackframes);
     _stackframes = nullptr;
   }
+  if (_last_stacktrace != nullptr) {
+    delete _last_stacktrace;
+    _last_stacktrace = nullptr;
+  }
   if (_load_barrier_buffer_epoch_0 != nullptr) {
     _load_barrier_buffer_epoch_0->set_retired();
     _load_barrier_buffer_epoch_0 = nullptr;
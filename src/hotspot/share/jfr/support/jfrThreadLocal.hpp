@@ -32,6 +32,7 @@ class Arena;
 class JavaThread;
 class JfrBuffer;
 class JfrStackFrame;
+class JfrStackTrace;
 class Thread;
 
 class JfrThreadLocal {
@@ -50,6 +51,7 @@ class JfrThreadLocal {
   JfrBuffer* _checkpoint_buffer_epoch_0;
   JfrBuffer* _checkpoint_buffer_epoch_1;
   mutable JfrStackFrame* _stackframes;
+  JfrStackTrace* _last_stacktrace;
   Arena* _dcmd_arena;
   JfrBlobHandle _thread;
   mutable traceid _vthread_id;
@@ -64,6 +66,7 @@ class JfrThreadLocal {
   jlong _cpu_time;
   jlong _wallclock_time;
   mutable u4 _stackdepth;
+  u4 _last_stacktrace_generation;
   volatile jint _entering_suspend_flag;
   mutable volatile int _critical_section;
   u2 _vthread_epoch;
@@ -147,6 +150,24 @@ class JfrThreadLocal {
 
   u4 stackdepth() const;
 
+  // Copy of the stack trace most recently added to the repository by this thread,
+  // valid as long as the repository generation has not moved on.
+  JfrStackTrace* last_stacktrace() const {
+    return _last_stacktrace;
+  }
+
+  void set_last_stacktrace(JfrStackTrace* stacktrace) {
+    _last_stacktrace = stacktrace;
+  }
+
+  u4 last_stacktrace_generation() const {
+    return _last_stacktrace_generation;
+  }
+
+  void set_last_stacktrace_generation(u4 generation) {
+    _last_stacktrace_generation = generation;
+  }
+
   void set_stackdepth(u4 depth) {
     _stackdepth = depth;
   }
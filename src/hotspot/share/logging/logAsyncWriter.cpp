@@ -81,8 +81,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The writer only waits while no data is available, so a single
+  // notification per batch is enough to wake it up.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
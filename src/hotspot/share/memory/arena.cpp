@@ -43,13 +43,15 @@ STATIC_ASSERT(is_aligned((int)Chunk::tiny_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::init_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::medium_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::size, ARENA_AMALLOC_ALIGNMENT));
+STATIC_ASSERT(is_aligned((int)Chunk::large_size, ARENA_AMALLOC_ALIGNMENT));
+STATIC_ASSERT(is_aligned((int)Chunk::huge_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
 class ChunkPool {
-  // Our four static pools
-  static constexpr int _num_pools = 4;
+  // Our six static pools
+  static constexpr int _num_pools = 6;
   static ChunkPool _pools[_num_pools];
 
   Chunk*       _first;
@@ -145,7 +147,7 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
   if (chunk == nullptr) {
     // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
     size_t bytes = ARENA_ALIGN(sizeof(Chunk)) + length;
-    void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+    void* p = os::malloc(bytes, mtChunk, MALLOC_CALLER_PC);
     if (p == nullptr && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
     }
@@ -168,7 +170,8 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
   }
 }
 
-ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
+ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size,
+                                  Chunk::large_size, Chunk::huge_size };
 
 class ChunkPoolCleaner : public PeriodicTask {
   static const int cleaning_interval = 5000; // cleaning interval in ms
@@ -277,6 +280,12 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   // (Note: all chunk sizes have to be 64-bit aligned)
   size_t len = MAX2(ARENA_ALIGN(x), (size_t) Chunk::size);
+  // Round moderately oversized requests (typical for large compiler arenas)
+  // up to a pooled size class, so that their chunks get recycled through the
+  // pools instead of fragmenting the C-heap with odd-sized malloc/free pairs.
+  if (len > Chunk::size && len <= Chunk::huge_size) {
+    len = (len <= Chunk::large_size) ? (size_t) Chunk::large_size : (size_t) Chunk::huge_size;
+  }
 
   if (MemTracker::check_exceeds_limit(x, _flags)) {
     return nullptr;
@@ -67,6 +67,8 @@ class Chunk {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
+    large_size = 64*K  - slack, // Size classes for growth requests exceeding size,
+    huge_size  = 128*K - slack, //  so that those chunks are pooled too
     non_pool_size = init_size + 32 // An initial size which is not one of above
   };
 
@@ -63,7 +63,9 @@ void ChunkManager::return_chunk_simple_locked(Metachunk* c) {
 ChunkManager::ChunkManager(const char* name, VirtualSpaceList* space_list) :
   _vslist(space_list),
   _name(name),
-  _chunks()
+  _chunks(),
+  _num_purges(0),
+  _reclaimed_words(0)
 {
 }
 
@@ -357,6 +359,10 @@ void ChunkManager::purge() {
   const size_t reserved_after = _vslist->reserved_words();
   const size_t committed_after = _vslist->committed_words();
 
+  _num_purges++;
+  assert(committed_after <= committed_before, "purge does not commit");
+  _reclaimed_words += committed_before - committed_after;
+
   // Print a nice report.
   if (reserved_after == reserved_before && committed_after == committed_before) {
     UL(info, "nothing reclaimed.");
@@ -405,6 +411,8 @@ void ChunkManager::add_to_statistics(ChunkManagerStats* out) const {
     out->_num_chunks[l] += _chunks.num_chunks_at_level(l);
     out->_committed_word_size[l] += _chunks.calc_committed_word_size_at_level(l);
   }
+  out->_num_purges += _num_purges;
+  out->_reclaimed_word_size += _reclaimed_words;
   DEBUG_ONLY(out->verify();)
 }
 
@@ -81,6 +81,11 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   // Freelists
   FreeChunkListVector _chunks;
 
+  // Number of purges and the committed words they returned to the
+  // Operating System over the VM lifetime (protected by Metaspace_lock).
+  uintx _num_purges;
+  size_t _reclaimed_words;
+
   // Returns true if this manager contains the given chunk. Slow (walks free lists) and
   // only needed for verifications.
   DEBUG_ONLY(bool contains_chunk(Metachunk* c) const;)
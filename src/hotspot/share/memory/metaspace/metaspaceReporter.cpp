@@ -278,7 +278,6 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
   ChunkManagerStats class_cm_stat;
   ChunkManagerStats total_cm_stat;
 
-  ChunkManager::chunkmanager_nonclass()->add_to_statistics(&non_class_cm_stat);
   if (Metaspace::using_class_space()) {
     ChunkManager::chunkmanager_nonclass()->add_to_statistics(&non_class_cm_stat);
     ChunkManager::chunkmanager_class()->add_to_statistics(&class_cm_stat);
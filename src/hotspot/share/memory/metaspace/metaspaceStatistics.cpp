@@ -38,6 +38,8 @@ void ChunkManagerStats::add(const ChunkManagerStats& other) {
     _num_chunks[l] += other._num_chunks[l];
     _committed_word_size[l] += other._committed_word_size[l];
   }
+  _num_purges += other._num_purges;
+  _reclaimed_word_size += other._reclaimed_word_size;
 }
 
 // Returns total word size of all chunks in this manager.
@@ -87,6 +89,9 @@ void ChunkManagerStats::print_on(outputStream* st, size_t scale) const {
   st->print(", committed: ");
   print_scaled_words_and_percentage(st, total_committed_size, total_size, scale);
   st->cr();
+  st->print("Purged " UINTX_FORMAT " times, reclaimed: ", _num_purges);
+  print_scaled_words(st, _reclaimed_word_size, scale);
+  st->cr();
 }
 
 #ifdef ASSERT
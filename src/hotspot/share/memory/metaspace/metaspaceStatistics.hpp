@@ -50,7 +50,13 @@ struct ChunkManagerStats {
   // Size, in words, of the sum of all committed areas in this chunk manager, per level.
   size_t _committed_word_size[chunklevel::NUM_CHUNK_LEVELS];
 
-  ChunkManagerStats() : _num_chunks(), _committed_word_size() {}
+  // How often this manager was purged, and how many committed words
+  // were uncommitted by those purges, over the VM lifetime.
+  uintx _num_purges;
+  size_t _reclaimed_word_size;
+
+  ChunkManagerStats() : _num_chunks(), _committed_word_size(),
+                        _num_purges(0), _reclaimed_word_size(0) {}
 
   void add(const ChunkManagerStats& other);
 
@@ -44,6 +44,9 @@ class MallocSite : public AllocationSite {
   void allocate(size_t size)      { _c.allocate(size);   }
   void deallocate(size_t size)    { _c.deallocate(size); }
 
+  // Turn sampled counters into estimates for all allocations
+  void scale(size_t factor)       { _c.scale(factor); }
+
   // Memory allocated from this code path
   size_t size()  const { return _c.size(); }
   // Peak memory ever allocated from this code path
@@ -131,6 +134,10 @@ class MallocSiteTable : AllStatic {
 
   // Access and copy a call stack from this table. Shared lock should be
   // acquired before access the entry.
+  // Marker of allocations whose call stack was not sampled
+  // (NMTDetailSampleInterval > 1); they are not recorded in the table.
+  static const uint32_t unsampled_marker = UINT32_MAX;
+
   static inline bool access_stack(NativeCallStack& stack, uint32_t marker) {
     MallocSite* site = malloc_site(marker);
     if (site != nullptr) {
@@ -66,16 +66,25 @@ void MallocMemorySnapshot::copy_to(MallocMemorySnapshot* s) {
   // copy is going on, because their size is adjusted using this
   // buffer in make_adjustment().
   ThreadCritical tc;
-  s->_all_mallocs = _all_mallocs;
-  size_t total_size = 0;
-  size_t total_count = 0;
   for (int index = 0; index < mt_number_of_types; index ++) {
     s->_malloc[index] = _malloc[index];
-    total_size += s->_malloc[index].malloc_size();
-    total_count += s->_malloc[index].malloc_count();
   }
-  // malloc counters may be updated concurrently
-  s->_all_mallocs.set_size_and_count(total_size, total_count);
+}
+
+size_t MallocMemorySnapshot::total_count() const {
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    count += _malloc[index].malloc_count();
+  }
+  return count;
+}
+
+size_t MallocMemorySnapshot::total_malloc() const {
+  size_t amount = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    amount += _malloc[index].malloc_size();
+  }
+  return amount;
 }
 
 // Total malloc'd memory used by arenas
@@ -93,7 +102,6 @@ void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
   int chunk_idx = NMTUtil::flag_to_index(mtChunk);
   _malloc[chunk_idx].record_free(arena_size);
-  _all_mallocs.deallocate(arena_size);
 }
 
 void MallocMemorySummary::initialize() {
@@ -168,7 +176,7 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
 
 // Record a malloc memory allocation
 void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
-  const NativeCallStack& stack)
+  const NativeCallStack& stack, bool sampled)
 {
   assert(MemTracker::enabled(), "precondition");
   assert(malloc_base != nullptr, "precondition");
@@ -176,7 +184,11 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
   MallocMemorySummary::record_malloc(size, flags);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    if (!sampled) {
+      mst_marker = MallocSiteTable::unsampled_marker;
+    } else {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
@@ -214,7 +226,8 @@ void* MallocTracker::record_free_block(void* memblock) {
 
 void MallocTracker::deaccount(MallocHeader::FreeInfo free_info) {
   MallocMemorySummary::record_free(free_info.size, free_info.flags);
-  if (MemTracker::tracking_level() == NMT_detail) {
+  if (MemTracker::tracking_level() == NMT_detail &&
+      free_info.mst_marker != MallocSiteTable::unsampled_marker) {
     MallocSiteTable::deallocation_at(free_info.size, free_info.mst_marker);
   }
 }
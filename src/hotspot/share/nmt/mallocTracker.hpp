@@ -61,6 +61,15 @@ class MemoryCounter {
     update_peak(size, count);
   }
 
+  // Scale all counters, including the peak, by factor. Not thread safe,
+  // only for use on copies.
+  inline void scale(size_t factor) {
+    _size *= factor;
+    _count *= factor;
+    _peak_size *= factor;
+    _peak_count *= factor;
+  }
+
   inline void allocate(size_t sz) {
     size_t cnt = Atomic::add(&_count, size_t(1), memory_order_relaxed);
     if (sz > 0) {
@@ -150,8 +159,10 @@ class MallocMemorySnapshot {
   friend class MallocMemorySummary;
 
  private:
+  // There is deliberately no running grand total: a counter shared by all
+  // categories would be hit by every malloc and free on every thread.
+  // Totals are summed over the categories when read instead.
   MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _all_mallocs;
 
 
  public:
@@ -166,19 +177,20 @@ class MallocMemorySnapshot {
   }
 
   inline size_t malloc_overhead() const {
-    return _all_mallocs.count() * sizeof(MallocHeader);
+    return total_count() * sizeof(MallocHeader);
   }
 
   // Total malloc invocation count
-  size_t total_count() const {
-    return _all_mallocs.count();
-  }
+  size_t total_count() const;
 
   // Total malloc'd memory amount
   size_t total() const {
-    return _all_mallocs.size() + malloc_overhead() + total_arena();
+    return total_malloc() + malloc_overhead() + total_arena();
   }
 
+  // Total malloc'd memory, excluding arenas and malloc headers
+  size_t total_malloc() const;
+
   // Total malloc'd memory used by arenas
   size_t total_arena() const;
 
@@ -211,12 +223,10 @@ class MallocMemorySummary : AllStatic {
 
    static inline void record_malloc(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_malloc(size);
-     as_snapshot()->_all_mallocs.allocate(size);
    }
 
    static inline void record_free(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_free(size);
-     as_snapshot()->_all_mallocs.deallocate(size);
    }
 
    static inline void record_new_arena(MEMFLAGS flag) {
@@ -269,9 +279,10 @@ class MallocTracker : AllStatic {
   // memblock = (char*)malloc_base + sizeof(nmt header)
   //
 
-  // Record  malloc on specified memory block
+  // Record  malloc on specified memory block. In detail mode, the call
+  // stack is only recorded if sampled (see NMTDetailSampleInterval).
   static void* record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
-    const NativeCallStack& stack);
+    const NativeCallStack& stack, bool sampled);
 
   // Given a block returned by os::malloc() or os::realloc():
   // deaccount block from NMT, mark its header as dead and return pointer to header.
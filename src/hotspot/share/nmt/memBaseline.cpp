@@ -93,7 +93,11 @@ class MallocAllocationSiteWalker : public MallocSiteWalker {
 
   bool do_malloc_site(const MallocSite* site) {
     if (site->size() > 0) {
-      if (_malloc_sites.add(*site) != nullptr) {
+      MallocSite s(*site);
+      if (NMTDetailSampleInterval > 1) {
+        s.scale(NMTDetailSampleInterval);
+      }
+      if (_malloc_sites.add(s) != nullptr) {
         return true;
       } else {
         return false;  // OOM
@@ -328,6 +328,11 @@ int MemDetailReporter::report_malloc_sites() {
   if (malloc_itr.is_empty()) return 0;
 
   outputStream* out = output();
+  if (NMTDetailSampleInterval > 1) {
+    out->print_cr("(Malloc call sites sampled one in " UINTX_FORMAT " allocations, "
+                  "sizes and counts are estimates.)", NMTDetailSampleInterval);
+    out->cr();
+  }
 
   const MallocSite* malloc_site;
   int num_omitted = 0;
@@ -49,6 +49,8 @@
 #endif
 
 NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
+THREAD_LOCAL uint32_t MemTracker::_sample_countdown = 0;
+THREAD_LOCAL uint32_t MemTracker::_sample_seed = 0;
 
 MemBaseline MemTracker::_baseline;
 
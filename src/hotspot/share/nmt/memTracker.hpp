@@ -29,6 +29,7 @@
 #include "nmt/nmtCommon.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "utilities/debug.hpp"
@@ -39,6 +40,19 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// Variants of the above for malloc call sites. With NMTDetailSampleInterval > 1,
+// only the sampled allocations walk the native stack. Virtual memory and
+// thread stacks are few and long lived, their call sites keep using
+// CURRENT_PC and CALLER_PC and are always recorded.
+#define MALLOC_CURRENT_PC ((MemTracker::tracking_level() == NMT_detail) ?     \
+                           (MemTracker::sample_malloc_call_stack() ?          \
+                            NativeCallStack(0) : UNSAMPLED_CALLSTACK) :       \
+                           FAKE_CALLSTACK)
+#define MALLOC_CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?     \
+                           (MemTracker::sample_malloc_call_stack() ?          \
+                            NativeCallStack(1) : UNSAMPLED_CALLSTACK) :       \
+                           FAKE_CALLSTACK)
+
 class MemBaseline;
 
 class MemTracker : AllStatic {
@@ -69,6 +83,30 @@ class MemTracker : AllStatic {
     return _tracking_level > NMT_off;
   }
 
+  // Returns true if the call stack of the current malloc should be recorded.
+  // With NMTDetailSampleInterval > 1 this holds for a random one in that many
+  // calls on each thread; the others are only accounted for in the summary.
+  static inline bool sample_malloc_call_stack() {
+    const uint32_t interval = (uint32_t)NMTDetailSampleInterval;
+    if (interval <= 1) {
+      return true;
+    }
+    if (_sample_countdown > 1) {
+      _sample_countdown--;
+      return false;
+    }
+    // Draw the distance to the next sample uniformly from [1, 2 * interval - 1]
+    // (xorshift32, seeded per thread), so the mean stays at interval without
+    // aliasing with periodic allocation patterns.
+    uint32_t x = (_sample_seed != 0) ? _sample_seed : ((uint32_t)(uintptr_t)&_sample_seed | 1);
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _sample_seed = x;
+    _sample_countdown = 1 + x % (2 * interval - 1);
+    return true;
+  }
+
   // Per-malloc overhead incurred by NMT, depending on the current NMT level
   static size_t overhead_per_malloc() {
     return enabled() ? MallocTracker::overhead_per_malloc : 0;
@@ -78,7 +116,8 @@ class MemTracker : AllStatic {
     const NativeCallStack& stack) {
     assert(mem_base != nullptr, "caller should handle null");
     if (enabled()) {
-      return MallocTracker::record_malloc(mem_base, size, flag, stack);
+      const bool sampled = tracking_level() == NMT_detail && !stack.is_unsampled();
+      return MallocTracker::record_malloc(mem_base, size, flag, stack, sampled);
     }
     return mem_base;
   }
@@ -245,6 +284,9 @@ class MemTracker : AllStatic {
   static MemBaseline      _baseline;
   // Query lock
   static Mutex*           _query_lock;
+  // Per-thread malloc call stack sampling state
+  static THREAD_LOCAL uint32_t _sample_countdown;
+  static THREAD_LOCAL uint32_t _sample_seed;
 };
 
 #endif // SHARE_NMT_MEMTRACKER_HPP
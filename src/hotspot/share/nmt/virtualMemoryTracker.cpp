@@ -56,6 +56,7 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
 }
 
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
+ReservedMemoryRegion* VirtualMemoryTracker::_last_found_region = nullptr;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
   return r1.compare(r2);
@@ -325,6 +326,20 @@ address ReservedMemoryRegion::thread_stack_uncommitted_bottom() const {
   return bottom;
 }
 
+ReservedMemoryRegion* VirtualMemoryTracker::find_reserved_region(const ReservedMemoryRegion& rgn) {
+  // Only trust the cached region if it fully contains the request, then it
+  // is the only reserved region the list lookup could have returned.
+  ReservedMemoryRegion* last = _last_found_region;
+  if (last != nullptr && last->contain_region(rgn.base(), rgn.size())) {
+    return last;
+  }
+  ReservedMemoryRegion* found = _reserved_regions->find(rgn);
+  if (found != nullptr) {
+    _last_found_region = found;
+  }
+  return found;
+}
+
 bool VirtualMemoryTracker::initialize(NMT_TrackingLevel level) {
   assert(_reserved_regions == nullptr, "only call once");
   if (level >= NMT_summary) {
@@ -341,7 +356,7 @@ bool VirtualMemoryTracker::add_reserved_region(address base_addr, size_t size,
   assert(size > 0, "Invalid size");
   assert(_reserved_regions != nullptr, "Sanity check");
   ReservedMemoryRegion  rgn(base_addr, size, stack, flag);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   log_debug(nmt)("Add reserved region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
                 rgn.flag_name(), p2i(rgn.base()), rgn.size());
@@ -420,7 +435,7 @@ void VirtualMemoryTracker::set_reserved_region_type(address addr, MEMFLAGS flag)
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion   rgn(addr, 1);
-  ReservedMemoryRegion*  reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion*  reserved_rgn = find_reserved_region(rgn);
   if (reserved_rgn != nullptr) {
     assert(reserved_rgn->contain_address(addr), "Containment");
     if (reserved_rgn->flag() != flag) {
@@ -438,7 +453,7 @@ bool VirtualMemoryTracker::add_committed_region(address addr, size_t size,
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("Add committed region \'%s\', No reserved region found for  (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
@@ -458,7 +473,7 @@ bool VirtualMemoryTracker::remove_uncommitted_region(address addr, size_t size)
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
   assert(reserved_rgn != nullptr, "No reserved region (" INTPTR_FORMAT ", " SIZE_FORMAT ")", p2i(addr), size);
   assert(reserved_rgn->contain_region(addr, size), "Not completely contained");
   const char* flag_name = reserved_rgn->flag_name();  // after remove, info is not complete
@@ -482,6 +497,7 @@ bool VirtualMemoryTracker::remove_released_region(ReservedMemoryRegion* rgn) {
   }
 
   VirtualMemorySummary::record_released_memory(rgn->size(), rgn->flag());
+  _last_found_region = nullptr;
   result =  _reserved_regions->remove(*rgn);
   log_debug(nmt)("Removed region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ") from _reserved_regions %s" ,
                 backup.flag_name(), p2i(backup.base()), backup.size(), (result ? "Succeeded" : "Failed"));
@@ -494,7 +510,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("No reserved region found for (" INTPTR_FORMAT ", " SIZE_FORMAT ")!",
@@ -523,7 +539,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
       // so we release them altogether.
       ReservedMemoryRegion class_rgn(addr + reserved_rgn->size(),
                                      (size - reserved_rgn->size()));
-      ReservedMemoryRegion* cls_rgn = _reserved_regions->find(class_rgn);
+      ReservedMemoryRegion* cls_rgn = find_reserved_region(class_rgn);
       assert(cls_rgn != nullptr, "Class space region  not recorded?");
       assert(cls_rgn->flag() == mtClass, "Must be class type");
       remove_released_region(reserved_rgn);
@@ -563,7 +579,7 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
 bool VirtualMemoryTracker::split_reserved_region(address addr, size_t size, size_t split, MEMFLAGS flag, MEMFLAGS split_flag) {
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(rgn);
   assert(reserved_rgn->same_region(addr, size), "Must be identical region");
   assert(reserved_rgn != nullptr, "No reserved region");
   assert(reserved_rgn->committed_size() == 0, "Splitting committed region?");
@@ -403,7 +403,14 @@ class VirtualMemoryTracker : AllStatic {
   static void snapshot_thread_stacks();
 
  private:
+  // Find the reserved region containing or overlapping rgn, consulting
+  // the most recently found region first.
+  static ReservedMemoryRegion* find_reserved_region(const ReservedMemoryRegion& rgn);
+
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  // Cached result of the last lookup. Commits and uncommits tend to hit
+  // the same reservation back to back, and the list lookup is linear.
+  static ReservedMemoryRegion* _last_found_region;
 };
 
 #endif // SHARE_NMT_VIRTUALMEMORYTRACKER_HPP
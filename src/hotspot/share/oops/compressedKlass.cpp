@@ -117,10 +117,18 @@ void CompressedKlassPointers::initialize(address addr, size_t len) {
 }
 #endif // !AARCH64 || ZERO
 
+const char* CompressedKlassPointers::mode_to_string() {
+  if (base() == nullptr) {
+    return shift() == 0 ? "32-bit" : "Zero based";
+  }
+  return shift() == 0 ? "Non-zero based" : "Non-zero based, shifted";
+}
+
 void CompressedKlassPointers::print_mode(outputStream* st) {
   st->print_cr("Narrow klass base: " PTR_FORMAT ", Narrow klass shift: %d, "
                "Narrow klass range: " SIZE_FORMAT_X, p2i(base()), shift(),
                range());
+  st->print_cr("Narrow klass encoding: %s", mode_to_string());
 }
 
 #endif // _LP64
@@ -84,6 +84,8 @@ class CompressedKlassPointers : public AllStatic {
   static void initialize(address addr, size_t len);
 
   static void     print_mode(outputStream* st);
+  // Human readable name of the chosen encoding, analogous to CompressedOops::mode_to_string().
+  static const char* mode_to_string();
 
   static address  base()               { return  _base; }
   static size_t   range()              { return  _range; }
@@ -1783,17 +1783,49 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
-  // Collect all blocks from existing Traces
+  // Collect all blocks from existing Traces. Uncommon blocks are split
+  // off into a cold tail that follows all the other blocks (but precedes
+  // the connector blocks), to keep the hot part of the code compact.
   _cfg.clear_blocks();
+  Block_List cold_blocks;
+  bool cold_flushed = !BlockLayoutSplitColdBlocks;
   for (int i = 0; i < new_count; i++) {
     Trace* tr = new_traces[i];
     if (tr != nullptr) {
+      if (!cold_flushed && tr->first_block()->is_connector()) {
+        flush_cold_blocks(cold_blocks);
+        cold_flushed = true;
+      }
       // push blocks onto the CFG list
+      bool prev_cold = false;
+      Block* prev = nullptr;
       for (Block* b = tr->first_block(); b != nullptr; b = tr->next(b)) {
-        _cfg.add_block(b);
+        bool cold = false;
+        if (!cold_flushed) {
+          // The fall-through of a branch that cannot be flipped stays with its branch.
+          cold = (prev != nullptr && no_flip_branch(prev)) ? prev_cold : _cfg.is_uncommon(b);
+        }
+        if (cold) {
+          cold_blocks.push(b);
+        } else {
+          _cfg.add_block(b);
+        }
+        prev = b;
+        prev_cold = cold;
       }
     }
   }
+  if (!cold_flushed) {
+    flush_cold_blocks(cold_blocks);
+  }
+}
+
+// Append the blocks split off by reorder_traces, in their trace order
+void PhaseBlockLayout::flush_cold_blocks(Block_List& cold_blocks) {
+  for (uint i = 0; i < cold_blocks.size(); i++) {
+    _cfg.add_block(cold_blocks[i]);
+  }
+  cold_blocks.reset();
 }
 
 // Order basic blocks based on frequency
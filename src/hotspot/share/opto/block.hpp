@@ -909,6 +909,7 @@ class PhaseBlockLayout : public Phase {
   void grow_traces();
   void merge_traces(bool loose_connections);
   void reorder_traces(int count);
+  void flush_cold_blocks(Block_List& cold_blocks);
   void union_traces(Trace* from, Trace* to);
 };
 
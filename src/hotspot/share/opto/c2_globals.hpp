@@ -335,6 +335,10 @@
   develop(bool, TraceLoopUnswitching, false,                                \
           "Trace loop unswitching")                                         \
                                                                             \
+  product(bool, HoistLoopInvariantFinalFieldLoads, false, DIAGNOSTIC,       \
+          "Hoist loads of trusted final instance fields with a loop "       \
+          "invariant receiver out of loops")                                \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally suppress vectorization set in VectorizeMethod")         \
                                                                             \
@@ -344,6 +348,11 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(uint, SuperWordReductionAccumulators, 1, DIAGNOSTIC,              \
+          "Number of independent vector accumulators used for unordered "   \
+          "reductions moved out of the loop.")                              \
+          range(1, 8)                                                       \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -390,6 +399,12 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(intx, PolymorphicInliningLimit, 2, EXPERIMENTAL,                  \
+          "Maximum number of profiled receivers inlined behind type "       \
+          "guards at a polymorphic call site; values above 2 need a "       \
+          "TypeProfileWidth at least as large")                             \
+          range(2, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -544,6 +559,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutSplitColdBlocks, false, DIAGNOSTIC,              \
+          "Place uncommon blocks after all frequently executed blocks "     \
+          "in the frequency based block layout")                            \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
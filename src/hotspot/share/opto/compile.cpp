@@ -4409,9 +4409,17 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
     _compile(Compile::current()),
     _log(nullptr),
     _phase_name(name),
+    _prev_memstat_phase(nullptr),
     _dolog(CITimeVerbose)
 {
   assert(_compile != nullptr, "sanity check");
+  if (CompilationMemoryStatistic::enabled()) {
+    // Attribute arena usage peaks to this phase
+    ArenaStatCounter* const arena_stat = CompilerThread::current()->arena_stat();
+    if (arena_stat != nullptr) {
+      _prev_memstat_phase = arena_stat->set_phase(name);
+    }
+  }
   if (_dolog) {
     _log = _compile->log();
   }
@@ -4423,6 +4431,12 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
 }
 
 Compile::TracePhase::~TracePhase() {
+  if (CompilationMemoryStatistic::enabled()) {
+    ArenaStatCounter* const arena_stat = CompilerThread::current()->arena_stat();
+    if (arena_stat != nullptr) {
+      arena_stat->set_phase(_prev_memstat_phase);
+    }
+  }
   if (_compile->failing()) return;
 #ifdef ASSERT
   if (PrintIdealNodeCount) {
@@ -240,6 +240,7 @@ class Compile : public Phase {
     Compile*    _compile;
     CompileLog* _log;
     const char* _phase_name;
+    const char* _prev_memstat_phase;
     bool _dolog;
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
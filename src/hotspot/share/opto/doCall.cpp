@@ -312,6 +312,63 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
       }
     }
 
+    // Try guarded inlining of several receivers at a polymorphic call site
+    // whose recorded receivers dominate the profile.
+    if (call_does_dispatch && site_count > 0 && UseTypeProfile &&
+        PolymorphicInliningLimit > 2 && speculative_receiver_type == nullptr &&
+        profile.receivers() > 2) {
+      int limit = MIN2(profile.receivers(), (int)PolymorphicInliningLimit);
+      float total_prob = 0;
+      for (int i = 0; i < limit; i++) {
+        total_prob += profile.receiver_prob(i);
+      }
+      if (100. * total_prob >= (float)TypeProfileMajorReceiverPercent) {
+        CallGenerator* hit_cgs[ciCallProfile::ReceiverLimit];
+        ciMethod* hit_methods[ciCallProfile::ReceiverLimit];
+        int inlined = 0;
+        for (int i = 0; i < limit; i++) {
+          hit_cgs[i] = nullptr;
+          hit_methods[i] = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+          if (hit_methods[i] != nullptr) {
+            CallGenerator* hit_cg = this->call_generator(hit_methods[i], vtable_index, !call_does_dispatch,
+                                                         jvms, allow_inline, prof_factor);
+            // A guard is only worth it if the target gets inlined.
+            if (hit_cg != nullptr && hit_cg->is_inline()) {
+              hit_cgs[i] = hit_cg;
+              inlined++;
+            }
+          }
+        }
+        if (inlined >= 2) {
+          // Megamorphic dispatch for all other receivers.
+          CallGenerator* miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                                             : CallGenerator::for_virtual_call(callee, vtable_index));
+          // Build the guard chain bottom-up; each guard is taken with the
+          // probability of its receiver among the receivers not yet checked.
+          float remaining_prob = 1.0f;
+          for (int i = 0; i < limit; i++) {
+            if (hit_cgs[i] != nullptr) {
+              remaining_prob -= profile.receiver_prob(i);
+            }
+          }
+          for (int i = limit - 1; i >= 0 && miss_cg != nullptr; i--) {
+            if (hit_cgs[i] == nullptr) {
+              continue;
+            }
+            float prob = profile.receiver_prob(i);
+            remaining_prob += prob;
+            float hit_prob = clamp(prob / MAX2(remaining_prob, prob), PROB_MIN, PROB_MAX);
+            trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), hit_methods[i], profile.receiver(i),
+                               site_count, profile.receiver_count(i));
+            miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, hit_cgs[i], hit_prob);
+          }
+          if (miss_cg != nullptr) {
+            return miss_cg;
+          }
+        }
+      }
+    }
+
     // If there is only one implementor of this interface then we
     // may be able to bind this invoke directly to the implementing
     // klass but we need both a dependence on the single interface
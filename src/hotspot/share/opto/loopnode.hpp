@@ -1564,6 +1564,7 @@ class PhaseIdealLoop : public PhaseTransform {
   Node* place_outside_loop(Node* useblock, IdealLoopTree* loop) const;
   Node* try_move_store_before_loop(Node* n, Node *n_ctrl);
   void try_move_store_after_loop(Node* n);
+  Node* try_hoist_final_field_load(Node* n, Node* n_ctrl);
   bool identical_backtoback_ifs(Node *n);
   bool can_split_if(Node *n_ctrl);
   bool cannot_split_division(const Node* n, const Node* region) const;
@@ -961,6 +961,102 @@ Node* PhaseIdealLoop::try_move_store_before_loop(Node* n, Node *n_ctrl) {
   return nullptr;
 }
 
+// Try to make a load from a trusted final instance field with a loop
+// invariant address independent of the memory state in the loop. Final
+// fields are only written by constructors, so as long as there is no
+// store to the field's memory slice in the loop, the load observes the
+// same value as at loop entry and can be hoisted.
+Node* PhaseIdealLoop::try_hoist_final_field_load(Node* n, Node* n_ctrl) {
+  if (!HoistLoopInvariantFinalFieldLoads || !n->is_Load()) {
+    return nullptr;
+  }
+  IdealLoopTree* n_loop = get_loop(n_ctrl);
+  if (n_loop == _ltree_root || !n_loop->is_loop() || n_loop->_irreducible ||
+      !n_loop->_head->is_Loop()) {
+    return nullptr;
+  }
+  LoadNode* load = n->as_Load();
+  if (load->is_mismatched_access() || load->is_unaligned_access() ||
+      load->is_unsafe_access() || load->is_acquire()) {
+    return nullptr;
+  }
+  const TypeInstPtr* adr_type = load->adr_type()->isa_instptr();
+  if (adr_type == nullptr) {
+    return nullptr;
+  }
+  Compile::AliasType* alias_type = C->alias_type(adr_type);
+  ciField* field = alias_type->field();
+  // @Stable fields may still change from their default value, only
+  // trust plain final instance fields.
+  if (field == nullptr || field->is_static() || !field->is_final() ||
+      field->is_stable() || !field->is_constant()) {
+    return nullptr;
+  }
+  Node* address = load->in(MemNode::Address);
+  if (n_loop->is_member(get_loop(get_ctrl(address)))) {
+    return nullptr;
+  }
+
+  // Walk the memory graph of the loop, starting at the load's memory and
+  // going around the back edge, to find the memory state on entry and
+  // to check that nothing in the loop writes the slice.
+  uint alias_idx = alias_type->index();
+  Node* head = n_loop->_head;
+  Node* entry_mem = nullptr;
+  ResourceMark rm;
+  Unique_Node_List wq;
+  wq.push(load->in(MemNode::Memory));
+  for (uint next = 0; next < wq.size(); next++) {
+    Node* m = wq.at(next);
+    if (wq.size() > 1000) {
+      return nullptr;
+    }
+    if (!n_loop->is_member(get_loop(ctrl_or_self(m)))) {
+      if (entry_mem != nullptr && entry_mem != m) {
+        return nullptr;
+      }
+      entry_mem = m;
+      continue;
+    }
+    if (m->is_Phi()) {
+      if (m->in(0) == head) {
+        // The entry state is reached through the loop head memory phi.
+        wq.push(m->in(LoopNode::EntryControl));
+        wq.push(m->in(LoopNode::LoopBackControl));
+      } else {
+        for (uint i = 1; i < m->req(); i++) {
+          wq.push(m->in(i));
+        }
+      }
+    } else if (m->is_MergeMem()) {
+      wq.push(m->as_MergeMem()->memory_at(alias_idx));
+    } else if (m->is_Mem() || m->is_LoadStore()) {
+      uint idx = C->get_alias_index(m->adr_type());
+      if (idx == alias_idx || idx == Compile::AliasIdxBot) {
+        return nullptr;
+      }
+      wq.push(m->in(MemNode::Memory));
+    } else if (m->Opcode() == Op_SCMemProj) {
+      wq.push(m->in(0));
+    } else if (m->is_Proj() && (m->in(0)->is_Call() || m->in(0)->is_MemBar())) {
+      // A call cannot write the final field of an object it did not
+      // allocate, and the receiver is allocated outside the loop.
+      wq.push(m->in(0)->in(TypeFunc::Memory));
+    } else {
+      return nullptr;
+    }
+  }
+  if (entry_mem == nullptr || entry_mem == load->in(MemNode::Memory)) {
+    return nullptr;
+  }
+
+  _igvn.replace_input_of(load, MemNode::Memory, entry_mem);
+  if (load->in(0) == nullptr) {
+    set_ctrl_and_loop(load, head->as_Loop()->skip_strip_mined()->in(LoopNode::EntryControl));
+  }
+  return load;
+}
+
 // Try moving a store out of a loop, right after the loop
 void PhaseIdealLoop::try_move_store_after_loop(Node* n) {
   if (n->is_Store() && n->in(0) != nullptr) {
@@ -1118,6 +1214,11 @@ Node *PhaseIdealLoop::split_if_with_blocks_pre( Node *n ) {
     return n;
   }
 
+  res = try_hoist_final_field_load(n, n_ctrl);
+  if (res != nullptr) {
+    return n;
+  }
+
   // Attempt to remix address expressions for loop invariants
   Node *m = remix_address_expressions( n );
   if( m ) return m;
@@ -4459,6 +4560,7 @@ void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
     _igvn.set_type(phi, vec_t);
 
     // Traverse down the chain of UnorderedReductions, and replace them with vector_accumulators.
+    Node_List accumulators;
     current = first_ur;
     while (true) {
       // Create vector_accumulator to replace current.
@@ -4468,29 +4570,78 @@ void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
       register_new_node(vector_accumulator, cl);
       _igvn.replace_node(current, vector_accumulator);
       VectorNode::trace_new_vector(vector_accumulator, "UnorderedReduction");
+      accumulators.push(vector_accumulator);
       if (current == last_ur) {
         break;
       }
       current = vector_accumulator->unique_out()->as_UnorderedReduction();
     }
 
-    // Create post-loop reduction.
+    // The vector_accumulators still form a single loop-carried chain, so each
+    // unrolled iteration has to wait for the previous accumulation. Since the
+    // reduction is unordered, we can distribute the accumulators round-robin
+    // over several independent vector phis, and combine them after the loop.
+    //
+    //   phi0 -> acc0 -> acc2 -> ... -> phi0     phi1 -> acc1 -> acc3 -> ... -> phi1
+    //
+    //   post_loop_reduction(init, vopc(last0, last1))
     Node* last_accumulator = phi->in(2);
-    Node* post_loop_reduction = ReductionNode::make(sopc, nullptr, init, last_accumulator, bt);
+    uint num_chains = MIN2((uint)SuperWordReductionAccumulators, accumulators.size());
+    Node_List chain_phis;
+    GrowableArray<Node*> combines;
+    if (num_chains > 1) {
+      Node_List chain_tails;
+      chain_phis.push(phi);
+      chain_tails.push(phi);
+      for (uint c = 1; c < num_chains; c++) {
+        PhiNode* chain_phi = PhiNode::make(cl, identity_vector, vec_t);
+        register_new_node(chain_phi, cl);
+        chain_phis.push(chain_phi);
+        chain_tails.push(chain_phi);
+      }
+      for (uint j = 0; j < accumulators.size(); j++) {
+        Node* accumulator = accumulators.at(j);
+        uint c = j % num_chains;
+        _igvn.replace_input_of(accumulator, 1, chain_tails.at(c));
+        chain_tails.map(c, accumulator);
+      }
+      // Close the chains on their phis, and combine the chains after the loop.
+      Node* combined = nullptr;
+      for (uint c = 0; c < num_chains; c++) {
+        _igvn.replace_input_of(chain_phis.at(c), 2, chain_tails.at(c));
+        if (combined == nullptr) {
+          combined = chain_tails.at(c);
+        } else {
+          combined = VectorNode::make(vopc, combined, chain_tails.at(c), vec_t);
+          combines.push(combined);
+        }
+      }
+    }
+    Node* post_loop_input = combines.is_empty() ? last_accumulator : combines.last();
+
+    // Create post-loop reduction.
+    Node* post_loop_reduction = ReductionNode::make(sopc, nullptr, init, post_loop_input, bt);
 
     // Take over uses of last_accumulator that are not in the loop.
     for (DUIterator i = last_accumulator->outs(); last_accumulator->has_out(i); i++) {
       Node* use = last_accumulator->out(i);
-      if (use != phi && use != post_loop_reduction) {
+      if (use != phi && !chain_phis.contains(use) &&
+          use != post_loop_reduction && !combines.contains(use)) {
         assert(ctrl_or_self(use) != cl, "use must be outside loop");
         use->replace_edge(last_accumulator, post_loop_reduction,  &_igvn);
         --i;
       }
     }
-    register_new_node(post_loop_reduction, get_late_ctrl(post_loop_reduction, cl));
+    Node* post_loop_ctrl = get_late_ctrl(post_loop_reduction, cl);
+    // The combining vector ops live after the loop, right with the post-loop reduction.
+    for (int j = 0; j < combines.length(); j++) {
+      register_new_node(combines.at(j), post_loop_ctrl);
+      VectorNode::trace_new_vector(combines.at(j), "UnorderedReduction");
+    }
+    register_new_node(post_loop_reduction, post_loop_ctrl);
     VectorNode::trace_new_vector(post_loop_reduction, "UnorderedReduction");
 
-    assert(last_accumulator->outcnt() == 2, "last_accumulator has 2 uses: phi and post_loop_reduction");
+    assert(last_accumulator->outcnt() == 2, "last_accumulator has 2 uses: phi and post_loop_reduction (or combine)");
     assert(post_loop_reduction->outcnt() > 0, "should have taken over all non loop uses of last_accumulator");
     assert(phi->outcnt() == 1, "accumulator is the only use of phi");
   }
@@ -48,10 +48,10 @@
 NodeHash::NodeHash(Arena *arena, uint est_max_size) :
   _a(arena),
   _max( round_up(est_max_size < NODE_HASH_MINIMUM_SIZE ? NODE_HASH_MINIMUM_SIZE : est_max_size) ),
-  _inserts(0), _insert_limit( insert_limit() ),
+  _inserts(0), _sentinels(0), _insert_limit( insert_limit() ),
   _table( NEW_ARENA_ARRAY( _a , Node* , _max ) )
 #ifndef PRODUCT
-  , _grows(0),_look_probes(0), _lookup_hits(0), _lookup_misses(0),
+  , _grows(0), _purges(0), _look_probes(0), _lookup_hits(0), _lookup_misses(0),
   _insert_probes(0), _delete_probes(0), _delete_hits(0), _delete_misses(0),
    _total_inserts(0), _total_insert_probes(0)
 #endif
@@ -150,7 +150,13 @@ Node *NodeHash::hash_find_insert( Node *n ) {
     k = _table[key];            // Get hashed value
     if( !k ) {                  // ?Miss?
       NOT_PRODUCT( _lookup_misses++ );
-      key = (first_sentinel == 0) ? key : first_sentinel; // ?saw sentinel?
+      if (first_sentinel != 0) { // ?saw sentinel?
+        // Reuse the deleted entry, occupancy does not change
+        _table[first_sentinel] = n;
+        _sentinels--;
+        debug_only(n->enter_hash_lock()); // Lock down the node while in the table.
+        return nullptr;         // Miss!
+      }
       _table[key] = n;          // Insert into table!
       debug_only(n->enter_hash_lock()); // Lock down the node while in the table.
       check_grow();             // Grow table if insert hit limit
@@ -175,13 +181,13 @@ void NodeHash::hash_insert( Node *n ) {
   if (hash == Node::NO_HASH) {
     return;
   }
-  check_grow();
   uint key = hash & (_max-1);
   uint stride = key | 0x01;
 
+  Node *k;
   while( 1 ) {                  // While probing hash table
     NOT_PRODUCT( _insert_probes++ );
-    Node *k = _table[key];      // Get hashed value
+    k = _table[key];            // Get hashed value
     if( !k || (k == _sentinel) ) break;       // Found a slot
     assert( k != n, "already inserted" );
     // if( PrintCompilation && PrintOptoStatistics && Verbose ) { tty->print("  conflict: "); k->dump(); conflict = true; }
@@ -190,6 +196,11 @@ void NodeHash::hash_insert( Node *n ) {
   _table[key] = n;              // Insert into table!
   debug_only(n->enter_hash_lock()); // Lock down the node while in the table.
   // if( conflict ) { n->dump(); }
+  if (k == _sentinel) {
+    _sentinels--;               // Reused a deleted entry
+  } else {
+    check_grow();               // Grow table if insert hit limit
+  }
 }
 
 //------------------------------hash_delete------------------------------------
@@ -215,6 +226,7 @@ bool NodeHash::hash_delete( const Node *n ) {
     else if( n == k ) {
       NOT_PRODUCT( _delete_hits++ );
       _table[key] = _sentinel;  // Hit! Label as deleted entry
+      _sentinels++;
       debug_only(((Node*)n)->exit_hash_lock()); // Unlock the node upon removal from table.
       return true;
     }
@@ -236,20 +248,31 @@ uint NodeHash::round_up(uint x) {
 }
 
 //------------------------------grow-------------------------------------------
-// Grow _table to next power of 2 and insert old entries
+// Grow _table to next power of 2 and insert old entries.  IGVN deletes and
+// reinserts nodes all the time, so when most of the occupied entries are
+// sentinels, rehash at the same size instead: that drops the sentinels,
+// which only lengthen probe sequences, without doubling the table.
 void  NodeHash::grow() {
   // Record old state
   uint   old_max   = _max;
   Node **old_table = _table;
-  // Construct new table with twice the space
+  bool   purge     = _sentinels > (_inserts >> 1);
+  // Construct new table with twice the space, or the same space if purging
 #ifndef PRODUCT
-  _grows++;
+  if (purge) {
+    _purges++;
+  } else {
+    _grows++;
+  }
   _total_inserts       += _inserts;
   _total_insert_probes += _insert_probes;
   _insert_probes   = 0;
 #endif
   _inserts         = 0;
-  _max     = _max << 1;
+  _sentinels       = 0;
+  if (!purge) {
+    _max   = _max << 1;
+  }
   _table   = NEW_ARENA_ARRAY( _a , Node* , _max ); // (Node**)_a->Amalloc( _max * sizeof(Node*) );
   memset(_table,0,sizeof(Node*)*_max);
   _insert_limit = insert_limit();
@@ -275,6 +298,8 @@ void  NodeHash::clear() {
 #endif
 
   memset( _table, 0, _max * sizeof(Node*) );
+  _inserts   = 0;
+  _sentinels = 0;
 }
 
 //-----------------------remove_useless_nodes----------------------------------
@@ -291,6 +316,7 @@ void NodeHash::remove_useless_nodes(VectorSet &useful) {
     if(n != nullptr && n != sentinel_node && !useful.test(n->_idx)) {
       debug_only(n->exit_hash_lock()); // Unlock the node when removed
       _table[i] = sentinel_node;       // Replace with placeholder
+      _sentinels++;
     }
   }
 }
@@ -330,7 +356,7 @@ void NodeHash::dump() {
           tty->print("%d/%d/%d ",i,_table[i]->hash()&(_max-1),_table[i]->_idx);
       }
     }
-    tty->print("\nGVN Hash stats:  %d grows to %d max_size\n", _grows, _max);
+    tty->print("\nGVN Hash stats:  %d grows to %d max_size, %d purges\n", _grows, _max, _purges);
     tty->print("  %d/%d (%8.1f%% full)\n", _inserts, _max, (double)_inserts/_max*100.0);
     tty->print("  %dp/(%dh+%dm) (%8.2f probes/lookup)\n", _look_probes, _lookup_hits, _lookup_misses, (double)_look_probes/(_lookup_hits+_lookup_misses));
     tty->print("  %dp/%di (%8.2f probes/insert)\n", _total_insert_probes, _total_inserts, (double)_total_insert_probes/_total_inserts);
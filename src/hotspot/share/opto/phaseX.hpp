@@ -56,7 +56,8 @@ class NodeHash : public AnyObj {
 protected:
   Arena *_a;                    // Arena to allocate in
   uint   _max;                  // Size of table (power of 2)
-  uint   _inserts;              // For grow and debug, count of hash_inserts
+  uint   _inserts;              // For grow and debug, count of occupied entries
+  uint   _sentinels;            // Count of _sentinel entries in _table
   uint   _insert_limit;         // 'grow' when _inserts reaches _insert_limit
   Node **_table;                // Hash table of Node pointers
   Node  *_sentinel;             // Replaces deleted entries in hash table
@@ -70,6 +71,7 @@ class NodeHash : public AnyObj {
   Node  *hash_find_insert(Node*);// If not in table insert else return found node
   void   hash_insert(Node*);    // Insert into hash table
   bool   hash_delete(const Node*);// Replace with _sentinel in hash table
+  // Called after an insert into an empty entry
   void   check_grow() {
     _inserts++;
     if( _inserts == _insert_limit ) { grow(); }
@@ -77,7 +79,7 @@ class NodeHash : public AnyObj {
     assert( _inserts < _max, "hash table overflow" );
   }
   static uint round_up(uint);   // Round up to nearest power of 2
-  void   grow();                // Grow _table to next power of 2 and rehash
+  void   grow();                // Grow _table to next power of 2 (or purge sentinels) and rehash
   // Return 75% of _max, rounded up.
   uint   insert_limit() const { return _max - (_max>>2); }
 
@@ -99,6 +101,7 @@ class NodeHash : public AnyObj {
   Node  *find_index(uint idx);  // For debugging
   void   dump();                // For debugging, dump statistics
   uint   _grows;                // For debugging, count of table grow()s
+  uint   _purges;               // For debugging, count of same-size rehashes dropping sentinels
   uint   _look_probes;          // For debugging, count of hash probes
   uint   _lookup_hits;          // For debugging, count of hash_finds
   uint   _lookup_misses;        // For debugging, count of hash_finds
@@ -1935,13 +1935,56 @@ bool SuperWord::profitable(const Node_List* p) const {
     // Verify that CMove has a matching Bool pack
     BoolNode* bol = p0->in(1)->as_Bool();
     if (bol == nullptr || get_pack(bol) == nullptr) {
+#ifndef PRODUCT
+      if (is_trace_superword_cmove()) {
+        tty->print_cr("SuperWord::profitable: CMove without Bool pack");
+        p0->dump();
+      }
+#endif
       return false;
     }
     // Verify that Bool has a matching Cmp pack
     CmpNode* cmp = bol->in(1)->as_Cmp();
     if (cmp == nullptr || get_pack(cmp) == nullptr) {
+#ifndef PRODUCT
+      if (is_trace_superword_cmove()) {
+        tty->print_cr("SuperWord::profitable: CMove without Cmp pack");
+        p0->dump();
+      }
+#endif
       return false;
     }
+    // Only signed and floating point compares map to VectorMaskCmp.
+    int cmp_op = cmp->Opcode();
+    if (cmp_op != Op_CmpI && cmp_op != Op_CmpL &&
+        cmp_op != Op_CmpF && cmp_op != Op_CmpD) {
+#ifndef PRODUCT
+      if (is_trace_superword_cmove()) {
+        tty->print_cr("SuperWord::profitable: CMove with unsupported compare");
+        cmp->dump();
+      }
+#endif
+      return false;
+    }
+    // The mask produced by the compare must have the same lane width as
+    // the blended values.
+    if (type2aelembytes(velt_basic_type(cmp)) != type2aelembytes(velt_basic_type(p0))) {
+#ifndef PRODUCT
+      if (is_trace_superword_cmove()) {
+        tty->print_cr("SuperWord::profitable: CMove with compare of different width (%s vs %s)",
+                      type2name(velt_basic_type(cmp)), type2name(velt_basic_type(p0)));
+        p0->dump();
+      }
+#endif
+      return false;
+    }
+#ifndef PRODUCT
+    if (is_trace_superword_cmove()) {
+      tty->print_cr("SuperWord::profitable: if-converting CMove pack of %u %s",
+                    p->size(), type2name(velt_basic_type(p0)));
+      p0->dump();
+    }
+#endif
   }
   return true;
 }
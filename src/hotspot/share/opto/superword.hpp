@@ -522,6 +522,11 @@ class SuperWord : public ResourceObj {
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_PACKSET);
   }
 
+  bool is_trace_superword_cmove() const {
+    return TraceSuperWord ||
+           _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_CMOVE);
+  }
+
   bool is_trace_superword_info() const {
     return TraceSuperWord ||
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_INFO);
@@ -539,6 +544,7 @@ class SuperWord : public ResourceObj {
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_ADJACENT_MEMOPS) ||
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_REJECTIONS) ||
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_PACKSET) ||
+           _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_CMOVE) ||
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_INFO) ||
            _vloop.vtrace().is_trace(TraceAutoVectorizationTag::SW_VERBOSE);
   }
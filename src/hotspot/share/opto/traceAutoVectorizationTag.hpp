@@ -41,6 +41,7 @@
   flags(SW_ADJACENT_MEMOPS,   "Trace SuperWord::find_adjacent_refs") \
   flags(SW_REJECTIONS,        "Trace SuperWord rejections (non vectorizations)") \
   flags(SW_PACKSET,           "Trace SuperWord packset at different stages") \
+  flags(SW_CMOVE,             "Trace SuperWord if-conversion (Cmp/Bool/CMove packs)") \
   flags(SW_INFO,              "Trace SuperWord info (equivalent to TraceSuperWord)") \
   flags(SW_VERBOSE,           "Trace SuperWord verbose (all SW tags enabled)") \
   flags(ALIGN_VECTOR,         "Trace AlignVector") \
@@ -119,12 +120,14 @@ class TraceAutoVectorizationTagValidator {
         _tags.at_put(SW_ADJACENT_MEMOPS, set_bit);
         _tags.at_put(SW_REJECTIONS, set_bit);
         _tags.at_put(SW_PACKSET, set_bit);
+        _tags.at_put(SW_CMOVE, set_bit);
         _tags.at_put(SW_INFO, set_bit);
         _tags.at_put(SW_VERBOSE, set_bit);
       } else if (SW_INFO == tag) {
         _tags.at_put(SW_ADJACENT_MEMOPS, set_bit);
         _tags.at_put(SW_REJECTIONS, set_bit);
         _tags.at_put(SW_PACKSET, set_bit);
+        _tags.at_put(SW_CMOVE, set_bit);
         _tags.at_put(SW_INFO, set_bit);
       } else {
         assert(tag < TRACE_AUTO_VECTORIZATION_TAG_NUM, "out of bounds");
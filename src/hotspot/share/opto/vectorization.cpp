@@ -569,7 +569,7 @@ bool VPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -665,6 +665,19 @@ bool VPointer::scaled_iv(Node* n) {
   return false;
 }
 
+// Constant int, or constant long that fits into an int.
+static bool int_con(const Node* n, jint& con) {
+  if (n->Opcode() == Op_ConI) {
+    con = n->get_int();
+    return true;
+  }
+  if (n->Opcode() == Op_ConL && n->find_long_type()->higher_equal(TypeLong::INT)) {
+    con = (jint)n->get_long();
+    return true;
+  }
+  return false;
+}
+
 // Match: offset is (k [+/- invariant])
 // where k maybe zero and invariant is optional, but not both.
 bool VPointer::offset_plus_k(Node* n, bool negate) {
@@ -694,27 +707,29 @@ bool VPointer::offset_plus_k(Node* n, bool negate) {
   if (_analyze_only && is_loop_member(n)) {
     _nstack->push(n, _stack_idx++);
   }
-  if (opc == Op_AddI) {
-    if (n->in(2)->is_Con() && invariant(n->in(1))) {
+  // Long arithmetic shows up in off-heap (MemorySegment) addressing.
+  jint con = 0;
+  if (opc == Op_AddI || opc == Op_AddL) {
+    if (int_con(n->in(2), con) && invariant(n->in(1))) {
       maybe_add_to_invar(n->in(1), negate);
-      _offset += negate ? -(n->in(2)->get_int()) : n->in(2)->get_int();
+      _offset += negate ? -con : con;
       NOT_PRODUCT(_tracer.offset_plus_k_6(n, _invar, negate, _offset);)
       return true;
-    } else if (n->in(1)->is_Con() && invariant(n->in(2))) {
-      _offset += negate ? -(n->in(1)->get_int()) : n->in(1)->get_int();
+    } else if (int_con(n->in(1), con) && invariant(n->in(2))) {
+      _offset += negate ? -con : con;
       maybe_add_to_invar(n->in(2), negate);
       NOT_PRODUCT(_tracer.offset_plus_k_7(n, _invar, negate, _offset);)
       return true;
     }
   }
-  if (opc == Op_SubI) {
-    if (n->in(2)->is_Con() && invariant(n->in(1))) {
+  if (opc == Op_SubI || opc == Op_SubL) {
+    if (int_con(n->in(2), con) && invariant(n->in(1))) {
       maybe_add_to_invar(n->in(1), negate);
-      _offset += !negate ? -(n->in(2)->get_int()) : n->in(2)->get_int();
+      _offset += !negate ? -con : con;
       NOT_PRODUCT(_tracer.offset_plus_k_8(n, _invar, negate, _offset);)
       return true;
-    } else if (n->in(1)->is_Con() && invariant(n->in(2))) {
-      _offset += negate ? -(n->in(1)->get_int()) : n->in(1)->get_int();
+    } else if (int_con(n->in(1), con) && invariant(n->in(2))) {
+      _offset += negate ? -con : con;
       maybe_add_to_invar(n->in(2), !negate);
       NOT_PRODUCT(_tracer.offset_plus_k_9(n, _invar, !negate, _offset);)
       return true;
@@ -901,7 +916,7 @@ void VPointer::Tracer::scaled_iv_plus_offset_3(Node* n) {
 
 void VPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(1) is scaled_iv: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(2) is offset_plus_k: ", n->in(2)->_idx); n->in(2)->dump();
   }
@@ -909,7 +924,7 @@ void VPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
 
 void VPointer::Tracer::scaled_iv_plus_offset_5(Node* n) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(2) is scaled_iv: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(1) is offset_plus_k: ", n->in(1)->_idx); n->in(1)->dump();
   }
@@ -1054,8 +1069,8 @@ void VPointer::Tracer::offset_plus_k_5(Node* n, Node* _invar) {
 
 void VPointer::Tracer::offset_plus_k_6(Node* n, Node* _invar, bool _negate_invar, int _offset) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_AddI PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
-    n->_idx, _negate_invar, _invar->_idx, _offset);
+    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_%s PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
+    n->_idx, n->Name(), _negate_invar, _invar->_idx, _offset);
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(2) is Con: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(1) is invariant: ", _invar->_idx); _invar->dump();
   }
@@ -1063,8 +1078,8 @@ void VPointer::Tracer::offset_plus_k_6(Node* n, Node* _invar, bool _negate_invar
 
 void VPointer::Tracer::offset_plus_k_7(Node* n, Node* _invar, bool _negate_invar, int _offset) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_AddI PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
-    n->_idx, _negate_invar, _invar->_idx, _offset);
+    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_%s PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
+    n->_idx, n->Name(), _negate_invar, _invar->_idx, _offset);
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(1) is Con: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(2) is invariant: ", _invar->_idx); _invar->dump();
   }
@@ -1072,8 +1087,8 @@ void VPointer::Tracer::offset_plus_k_7(Node* n, Node* _invar, bool _negate_invar
 
 void VPointer::Tracer::offset_plus_k_8(Node* n, Node* _invar, bool _negate_invar, int _offset) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_SubI is PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
-    n->_idx, _negate_invar, _invar->_idx, _offset);
+    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_%s is PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d",
+    n->_idx, n->Name(), _negate_invar, _invar->_idx, _offset);
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(2) is Con: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(1) is invariant: ", _invar->_idx); _invar->dump();
   }
@@ -1081,7 +1096,7 @@ void VPointer::Tracer::offset_plus_k_8(Node* n, Node* _invar, bool _negate_invar
 
 void VPointer::Tracer::offset_plus_k_9(Node* n, Node* _invar, bool _negate_invar, int _offset) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_SubI PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d", n->_idx, _negate_invar, _invar->_idx, _offset);
+    print_depth(); tty->print_cr(" %d VPointer::offset_plus_k: Op_%s PASSED, setting _debug_negate_invar = %d, _invar = %d, _offset = %d", n->_idx, n->Name(), _negate_invar, _invar->_idx, _offset);
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(1) is Con: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d VPointer::offset_plus_k: in(2) is invariant: ", _invar->_idx); _invar->dump();
   }
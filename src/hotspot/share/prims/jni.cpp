@@ -643,6 +643,7 @@ JNI_ENTRY(jint, jni_PushLocalFrame(JNIEnv *env, jint capacity))
   }
 
   thread->push_jni_handle_block();
+  thread->active_handles()->reserve_from_free_list(thread, capacity);
   jint ret = JNI_OK;
   HOTSPOT_JNI_PUSHLOCALFRAME_RETURN(ret);
   return ret;
@@ -86,7 +86,10 @@ class CPUTimeCounters: public CHeapObj<mtServiceability> {
     }
   }
 
+  static bool is_initialized() { return _instance != nullptr; }
+
   static void create_counter(CPUTimeGroups::CPUTimeType name);
+  // Returns null if the counter has not been created.
   static PerfCounter* get_counter(CPUTimeGroups::CPUTimeType name);
   static void update_counter(CPUTimeGroups::CPUTimeType name, jlong total);
 
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -1035,9 +1036,10 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
+  JFR_ONLY(EventMarkedDeoptimization event;)
 
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  int count = CodeCache::make_marked_nmethods_deoptimized();
 
   DeoptimizeMarkedClosure deopt;
   if (SafepointSynchronize::is_at_safepoint()) {
@@ -1045,11 +1047,75 @@ void Deoptimization::deoptimize_all_marked() {
   } else {
     Handshake::execute(&deopt);
   }
+
+  log_debug(deoptimization)("Deoptimized %d marked nmethods", count);
+#if INCLUDE_JFR
+  if (event.should_commit()) {
+    event.set_nmethodCount(count);
+    event.commit();
+  }
+#endif
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
+static uint total_trap_count(MethodData* mdo) {
+  uint total = mdo->overflow_trap_count();
+  for (uint reason = 0; reason < MethodData::trap_reason_limit(); reason++) {
+    total += mdo->trap_count(reason);
+  }
+  return total;
+}
+
+static GrowableArray<Method*>* _trapping_methods = nullptr;
+
+static void collect_trapping_method(Method* m) {
+  MethodData* mdo = m->method_data();
+  if (mdo != nullptr && total_trap_count(mdo) > 0) {
+    _trapping_methods->append(m);
+  }
+}
+
+static int compare_trap_counts(Method** a, Method** b) {
+  uint count_a = total_trap_count((*a)->method_data());
+  uint count_b = total_trap_count((*b)->method_data());
+  return count_a > count_b ? -1 : (count_a < count_b ? 1 : 0);
+}
+
+void Deoptimization::print_trapping_methods(outputStream* st, int limit) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  ResourceMark rm;
+  GrowableArray<Method*> methods;
+  _trapping_methods = &methods;
+  ClassLoaderDataGraph::methods_do(collect_trapping_method);
+  _trapping_methods = nullptr;
+  methods.sort(compare_trap_counts);
+
+  for (int i = 0; i < methods.length() && i < limit; i++) {
+    Method* m = methods.at(i);
+    MethodData* mdo = m->method_data();
+    st->print("%6u ", total_trap_count(mdo));
+    m->print_short_name(st);
+    st->print_cr(" (decompiles: %u, recompiles after overflow: %u)",
+                 mdo->decompile_count(), mdo->overflow_recompile_count());
+    for (uint reason = 0; reason < MethodData::trap_reason_limit(); reason++) {
+      uint count = mdo->trap_count(reason);
+      if (count > 0) {
+        st->print_cr("         %s: %u", trap_reason_name((int)reason), count);
+      }
+    }
+    // Trap sites, as recorded in the per-bytecode profile
+    for (ProfileData* data = mdo->first_data(); mdo->is_valid(data); data = mdo->next_data(data)) {
+      if (data->trap_state() != 0) {
+        char buf[100];
+        st->print_cr("         bci %d: %s", data->bci(),
+                     format_trap_state(buf, sizeof(buf), data->trap_state()));
+      }
+    }
+  }
+}
+
 #if INCLUDE_JVMCI
 template<typename CacheType>
 class BoxCacheBase : public CHeapObj<mtCompiler> {
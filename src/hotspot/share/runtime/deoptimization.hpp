@@ -396,6 +396,10 @@ class Deoptimization : AllStatic {
   static const char* format_trap_state(char* buf, size_t buflen,
                                        int trap_state);
 
+  // Print the methods with the most uncommon traps recorded in their
+  // MethodData, at most limit of them. Must be called at a safepoint.
+  static void print_trapping_methods(outputStream* st, int limit);
+
   static bool reason_is_recorded_per_bytecode(DeoptReason reason) {
     return reason > Reason_none && reason <= Reason_RECORDED_LIMIT;
   }
@@ -571,6 +571,13 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uintx, NMTDetailSampleInterval, 1, EXPERIMENTAL,                  \
+          "With NativeMemoryTracking=detail, record the call stack of "     \
+          "only a random one in this many malloc calls and scale the "      \
+          "reported call site totals accordingly. Summary accounting "      \
+          "stays exact. 1 records every call stack")                        \
+          range(1, max_juint / 2)                                           \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -691,6 +698,10 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, ClassUnloadingWithConcurrentMark, true,                     \
           "Do unloading of classes with a concurrent marking cycle")        \
                                                                             \
+  product(bool, DeferClassLoaderDataPurge, false, EXPERIMENTAL,             \
+          "Let the ServiceThread delete class loader data unlinked in a "   \
+          "safepoint, in bounded steps, instead of doing it in the pause")  \
+                                                                            \
   develop(bool, PrintSystemDictionaryAtExit, false,                         \
           "Print the system dictionary at exit")                            \
                                                                             \
@@ -927,6 +938,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uint, CompilerThreadCPUBudget, 100, EXPERIMENTAL,                 \
+          "Percentage of the processors available to the VM, including "    \
+          "container limits, that the compiler threads may use before "     \
+          "UseDynamicNumberOfCompilerThreads stops adding threads")         \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -1838,6 +1855,11 @@ const int ObjectAlignmentInBytes = 8;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, UseJNIGlobalHandleCache, false, EXPERIMENTAL,               \
+          "Let each Java thread cache a few JNI global handle entries, "    \
+          "allocated in bulk, to reduce contention on the global handle "   \
+          "storage")                                                        \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -1869,6 +1891,11 @@ const int ObjectAlignmentInBytes = 8;
           "Minimum percentage of dead table entries for cleaning the table") \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, StringDeduplicationMaxActivePercent, 100, EXPERIMENTAL,     \
+          "Maximum percentage of elapsed time the deduplication thread "    \
+          "spends processing requests; it sleeps to stay below this")       \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
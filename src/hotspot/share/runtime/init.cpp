@@ -29,6 +29,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "interpreter/bytecodes.hpp"
+#include "logging/log.hpp"
 #include "logging/logAsyncWriter.hpp"
 #include "memory/universe.hpp"
 #include "nmt/memTracker.hpp"
@@ -44,6 +45,7 @@
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "sanitizers/leak.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_JVMCI
@@ -122,11 +124,16 @@ jint init_globals() {
   bytecodes_init();
   classLoader_init1();
   compilationPolicy_init();
-  codeCache_init();
+  { TraceTime timer("Code cache initialization", TRACETIME_LOG(Info, startuptime));
+    codeCache_init();
+  }
   VM_Version_init();              // depends on codeCache_init for emitting code
   initial_stubs_init();
-  jint status = universe_init();  // dependent on codeCache_init and
+  jint status;
+  { TraceTime timer("Universe initialization", TRACETIME_LOG(Info, startuptime));
+    status = universe_init();     // dependent on codeCache_init and
                                   // initial_stubs_init and metaspace_init.
+  }
   if (status != JNI_OK)
     return status;
 
@@ -146,7 +153,9 @@ jint init_globals() {
   accessFlags_init();
   InterfaceSupport_init();
   VMRegImpl::set_regName();  // need this before generate_stubs (for printing oop maps).
-  SharedRuntime::generate_stubs();
+  { TraceTime timer("SharedRuntime stubs generation", TRACETIME_LOG(Info, startuptime));
+    SharedRuntime::generate_stubs();
+  }
   return JNI_OK;
 }
 
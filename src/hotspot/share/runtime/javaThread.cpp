@@ -429,6 +429,7 @@ JavaThread::JavaThread() :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_global_handle_cache(nullptr),
 
   _monitor_chunks(nullptr),
 
@@ -487,6 +488,8 @@ JavaThread::JavaThread() :
   _cont_fastpath_thread_state(1),
   _held_monitor_count(0),
   _jni_monitor_count(0),
+  _profile_sample_countdown(0),
+  _profile_sample_seed(0),
 
   _handshake(this),
 
@@ -521,6 +524,16 @@ JavaThread::JavaThread() :
 
   set_requires_cross_modify_fence(false);
 
+#ifdef COMPILER1
+  // Start each thread at a random phase so that threads running the same
+  // method do not update its profile in lock step.
+  if (C1ProfileSampleRate > 1) {
+    _profile_sample_countdown = 1 + os::random() % (2 * C1ProfileSampleRate - 1);
+    // xorshift needs a non-zero seed
+    _profile_sample_seed = os::random() | 1;
+  }
+#endif
+
   pd_initialize();
   assert(deferred_card_mark().is_empty(), "Default MemRegion ctor");
 }
@@ -684,6 +697,7 @@ JavaThread::~JavaThread() {
   }
 
   // All Java related clean up happens in exit
+  assert(_jni_global_handle_cache == nullptr, "global handle cache not released");
   ThreadSafepointState::destroy(this);
   if (_thread_stat != nullptr) delete _thread_stat;
 
@@ -941,6 +955,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_global_handle_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1012,6 +1028,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_global_handle_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
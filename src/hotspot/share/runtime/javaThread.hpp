@@ -52,6 +52,7 @@
 class AsyncExceptionHandshake;
 class ContinuationEntry;
 class DeoptResourceMark;
+class JNIGlobalHandleCache;
 class JNIHandleBlock;
 class JVMCIRuntime;
 
@@ -157,6 +158,9 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Cache of JNI global handle entries, see UseJNIGlobalHandleCache
+  JNIGlobalHandleCache* _jni_global_handle_cache;
+
  public:
   // For tracking the heavyweight monitor the thread is pending on.
   ObjectMonitor* current_pending_monitor() {
@@ -187,6 +191,8 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIGlobalHandleCache* jni_global_handle_cache() const { return _jni_global_handle_cache; }
+  void set_jni_global_handle_cache(JNIGlobalHandleCache* cache) { _jni_global_handle_cache = cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -455,6 +461,10 @@ class JavaThread: public Thread {
   intx _held_monitor_count;  // used by continuations for fast lock detection
   intx _jni_monitor_count;
 
+  int _profile_sample_countdown;  // executions left until the next sampled C1 profile update
+                                  // (C1ProfileSampleRate)
+  int _profile_sample_seed;       // random state used to pick the next countdown
+
 private:
 
   friend class VMThread;
@@ -811,6 +821,8 @@ class JavaThread: public Thread {
   static ByteSize cont_entry_offset()         { return byte_offset_of(JavaThread, _cont_entry); }
   static ByteSize cont_fastpath_offset()      { return byte_offset_of(JavaThread, _cont_fastpath); }
   static ByteSize held_monitor_count_offset() { return byte_offset_of(JavaThread, _held_monitor_count); }
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+  static ByteSize profile_sample_seed_offset()      { return byte_offset_of(JavaThread, _profile_sample_seed); }
 
 #if INCLUDE_JVMTI
   static ByteSize is_in_VTMS_transition_offset()     { return byte_offset_of(JavaThread, _is_in_VTMS_transition); }
@@ -82,6 +82,53 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+JNIGlobalHandleCache::~JNIGlobalHandleCache() {
+  assert(_count == 0, "cached entries not released");
+}
+
+oop* JNIGlobalHandleCache::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    _count = (uint)storage->allocate(_entries, capacity);
+    if (_count == 0) {
+      return nullptr;
+    }
+  }
+  return _entries[--_count];
+}
+
+void JNIGlobalHandleCache::release_all(OopStorage* storage) {
+  storage->release(_entries, _count);
+  _count = 0;
+}
+
+static oop* allocate_global_entry(OopStorage* storage) {
+  Thread* thread = Thread::current();
+  if (UseJNIGlobalHandleCache && thread->is_Java_thread()) {
+    JavaThread* jt = JavaThread::cast(thread);
+    JNIGlobalHandleCache* cache = jt->jni_global_handle_cache();
+    if (cache == nullptr) {
+      if (jt->is_exiting()) {
+        // JavaThread::exit() releases the cache, don't create one that
+        // would never be released.
+        return storage->allocate();
+      }
+      cache = new JNIGlobalHandleCache();
+      jt->set_jni_global_handle_cache(cache);
+    }
+    return cache->allocate(storage);
+  }
+  return storage->allocate();
+}
+
+void JNIHandles::release_global_handle_cache(JavaThread* thread) {
+  JNIGlobalHandleCache* cache = thread->jni_global_handle_cache();
+  if (cache != nullptr) {
+    thread->set_jni_global_handle_cache(nullptr);
+    cache->release_all(global_handles());
+    delete cache;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +136,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry(global_handles());
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -387,6 +434,20 @@ void JNIHandleBlock::release_block(JNIHandleBlock* block, JavaThread* thread) {
   }
 }
 
+void JNIHandleBlock::reserve_from_free_list(JavaThread* thread, int capacity) {
+  assert(thread == Thread::current(), "sanity check");
+  assert(_top == 0 && _next == nullptr, "only for a fresh block");
+  // Only recycle blocks the thread already owns; a large requested capacity
+  // must not eagerly allocate memory that the frame may never use.
+  JNIHandleBlock* tail = this;
+  for (int needed = (capacity - 1) / block_size_in_oops;
+       needed > 0 && thread->free_handle_block() != nullptr;
+       needed--) {
+    tail->_next = allocate_block(thread);
+    tail = tail->_next;
+  }
+}
+
 
 void JNIHandleBlock::oops_do(OopClosure* f) {
   JNIHandleBlock* current_chain = this;
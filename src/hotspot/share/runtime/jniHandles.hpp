@@ -128,8 +128,37 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(OopClosure* f);
 
   static bool is_global_storage(const OopStorage* storage);
+
+  // Release the entries cached by thread for global handle allocation.
+  static void release_global_handle_cache(JavaThread* thread);
 };
 
+// Per-thread cache of entries for JNI global handles. The entries are
+// obtained from the global handle storage by bulk allocation, so that most
+// allocations don't need to take the storage's allocation mutex. Cached
+// entries are allocated in the storage but hold null until handed out.
+
+class JNIGlobalHandleCache : public CHeapObj<mtInternal> {
+  static const uint capacity = 16;
+
+  oop*  _entries[capacity];
+  uint  _count;
+
+  NONCOPYABLE(JNIGlobalHandleCache);
+
+ public:
+  JNIGlobalHandleCache() : _entries(), _count(0) {}
+  ~JNIGlobalHandleCache();
+
+  // Return an entry, refilling the cache from storage if needed, or
+  // null if storage allocation failed.
+  oop* allocate(OopStorage* storage);
+
+  // Release all cached entries back to storage.
+  void release_all(OopStorage* storage);
+
+  uint count() const { return _count; }
+};
 
 
 // JNI handle blocks holding local/global JNI handles
@@ -173,6 +202,10 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   static JNIHandleBlock* allocate_block(JavaThread* thread = nullptr, AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void release_block(JNIHandleBlock* block, JavaThread* thread = nullptr);
 
+  // Chain blocks from the thread-local free list behind this fresh block so
+  // that capacity handles can be allocated without rebuilding the free list.
+  void reserve_from_free_list(JavaThread* thread, int capacity);
+
   // JNI PushLocalFrame/PopLocalFrame support
   JNIHandleBlock* pop_frame_link() const          { return _pop_frame_link; }
   void set_pop_frame_link(JNIHandleBlock* block)  { _pop_frame_link = block; }
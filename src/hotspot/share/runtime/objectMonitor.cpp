@@ -445,6 +445,8 @@ bool ObjectMonitor::enter(JavaThread* current) {
     // time and with the same address are likely (but not guaranteed) to
     // belong to the same object.
     event.set_address((uintptr_t)this);
+    // Our own increment above is included in the count.
+    event.set_contenders(contentions() - 1);
   }
 
   { // Change java thread status to indicate blocked on monitor enter.
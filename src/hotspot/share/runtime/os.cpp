@@ -623,7 +623,7 @@ static void break_if_ptr_caught(void* ptr) {
 #endif // ASSERT
 
 void* os::malloc(size_t size, MEMFLAGS flags) {
-  return os::malloc(size, flags, CALLER_PC);
+  return os::malloc(size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -673,7 +673,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS flags) {
-  return os::realloc(memblock, size, flags, CALLER_PC);
+  return os::realloc(memblock, size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
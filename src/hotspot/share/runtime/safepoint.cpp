@@ -36,6 +36,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -63,6 +64,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -211,7 +213,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** straggler)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -243,6 +246,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   *initial_running = still_running;
 
   // If there is no thread still running, we are already done.
+  *straggler = nullptr;
   if (still_running <= 0) {
     assert(tss_head == nullptr, "Must be empty");
     return 1;
@@ -263,6 +267,8 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        // The last one found here is the thread we waited for the longest.
+        *straggler = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -344,6 +350,47 @@ void SafepointSynchronize::arm_safepoint() {
   }
 }
 
+// Report the last thread that had to be waited for, and where it stopped.
+// All threads are stopped now and we hold the Threads_lock, so the straggler
+// is alive and its stack can be walked.
+static void report_straggler(JavaThread* straggler, EventSafepointStraggler& event, uint64_t safepoint_id) {
+  LogTarget(Debug, safepoint) lt;
+  if (!event.should_commit() && !lt.is_enabled()) {
+    return;
+  }
+
+  ResourceMark rm;
+  Method* method = nullptr;
+  int bci = -1;
+  bool compiled = false;
+  if (straggler->has_last_Java_frame()) {
+    vframeStream vfst(straggler, false /* stop_at_java_call_stub */, false /* process_frames */);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+      compiled = !vfst.is_interpreted_frame();
+    }
+  }
+
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Last thread to reach safepoint: '%s'", straggler->name());
+    if (method != nullptr) {
+      ls.print(" at %s bci %d (%s)", method->external_name(), bci, compiled ? "compiled" : "interpreted");
+    }
+    ls.cr();
+  }
+
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_straggler(JFR_THREAD_ID(straggler));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_compiled(compiled);
+    event.commit();
+  }
+}
+
 // Roll all threads forward to a safepoint and suspend them all
 void SafepointSynchronize::begin() {
   assert(Thread::current()->is_VM_thread(), "Only VM thread may execute a safepoint");
@@ -380,13 +427,15 @@ void SafepointSynchronize::begin() {
   }
 
   EventSafepointStateSynchronization sync_event;
+  EventSafepointStraggler straggler_event;
   int initial_running = 0;
+  JavaThread* straggler = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &straggler);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -435,6 +484,10 @@ void SafepointSynchronize::begin() {
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
+  if (straggler != nullptr) {
+    report_straggler(straggler, straggler_event, _safepoint_id);
+  }
+
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
   EventSafepointCleanup cleanup_event;
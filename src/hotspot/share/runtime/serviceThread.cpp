@@ -94,6 +94,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     JvmtiDeferredEvent jvmti_event;
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
+    bool cldg_purge_work = false;
     bool jvmti_tagmap_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
@@ -124,6 +125,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
               (oop_handles_to_release = JavaThread::has_oop_handles_to_release()) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
+              (cldg_purge_work = ClassLoaderDataGraph::has_deferred_purge_work()) |
               (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset())
              ) == 0) {
         // Wait until notified that there is some work to do.
@@ -192,6 +194,10 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
       ClassLoaderDataGraph::safepoint_and_clean_metaspaces();
     }
 
+    if (cldg_purge_work) {
+      ClassLoaderDataGraph::purge_deferred();
+    }
+
     if (jvmti_tagmap_work) {
       JvmtiTagMap::flush_all_object_free_events();
     }
@@ -1606,6 +1606,7 @@ methodHandle SharedRuntime::handle_ic_miss_helper(TRAPS) {
 
   CompiledICLocker ml(caller_nm);
   CompiledIC* inline_cache = CompiledIC_before(caller_nm, caller_frame.pc());
+  inline_cache->data()->inc_miss_count();
   inline_cache->update(&call_info, receiver()->klass());
 
   return callee_method;
@@ -595,7 +595,7 @@ bool ObjectSynchronizer::enter_fast_impl(Handle obj, BasicLock* lock, JavaThread
         // with the longest critical section.
 
         log_info(monitorinflation)("LockStack capacity exceeded, inflating.");
-        ObjectMonitor* monitor = inflate_for(locking_thread, lock_stack.bottom(), inflate_cause_vm_internal);
+        ObjectMonitor* monitor = inflate_for(locking_thread, lock_stack.bottom(), inflate_cause_lock_stack_full);
         assert(monitor->owner() == Thread::current(), "must be owner=" PTR_FORMAT " current=" PTR_FORMAT " mark=" PTR_FORMAT,
                p2i(monitor->owner()), p2i(Thread::current()), monitor->object()->mark_acquire().value());
         assert(!lock_stack.is_full(), "must have made room here");
@@ -1363,6 +1363,17 @@ jlong ObjectSynchronizer::time_since_last_async_deflation_ms() {
   return (os::javaTimeNanos() - last_async_deflation_time_ns()) / (NANOUNITS / MILLIUNITS);
 }
 
+static volatile size_t _inflation_counts[ObjectSynchronizer::inflate_cause_nof];
+
+static void count_inflation(ObjectSynchronizer::InflateCause cause) {
+  assert(cause >= 0 && cause < ObjectSynchronizer::inflate_cause_nof, "invalid cause");
+  Atomic::inc(&_inflation_counts[cause], memory_order_relaxed);
+}
+
+size_t ObjectSynchronizer::inflation_count(const InflateCause cause) {
+  return Atomic::load(&_inflation_counts[cause]);
+}
+
 static void post_monitor_inflate_event(EventJavaMonitorInflate* event,
                                        const oop obj,
                                        ObjectSynchronizer::InflateCause cause) {
@@ -1490,6 +1501,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
         // Hopefully the performance counters are allocated on distinct
         // cache lines to avoid false sharing on MP systems ...
         OM_PERFDATA_OP(Inflations, inc());
+        count_inflation(cause);
         if (log_is_enabled(Trace, monitorinflation)) {
           ResourceMark rm;
           lsh.print_cr("inflate(has_locker): object=" INTPTR_FORMAT ", mark="
@@ -1589,6 +1601,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
       // Hopefully the performance counters are allocated on distinct cache lines
       // to avoid false sharing on MP systems ...
       OM_PERFDATA_OP(Inflations, inc());
+      count_inflation(cause);
       if (log_is_enabled(Trace, monitorinflation)) {
         ResourceMark rm;
         lsh.print_cr("inflate(has_locker): object=" INTPTR_FORMAT ", mark="
@@ -1631,6 +1644,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
     // Hopefully the performance counters are allocated on distinct
     // cache lines to avoid false sharing on MP systems ...
     OM_PERFDATA_OP(Inflations, inc());
+    count_inflation(cause);
     if (log_is_enabled(Trace, monitorinflation)) {
       ResourceMark rm;
       lsh.print_cr("inflate(unlocked): object=" INTPTR_FORMAT ", mark="
@@ -1911,6 +1925,7 @@ const char* ObjectSynchronizer::inflate_cause_name(const InflateCause cause) {
     case inflate_cause_hash_code:      return "Monitor Hash Code";
     case inflate_cause_jni_enter:      return "JNI Monitor Enter";
     case inflate_cause_jni_exit:       return "JNI Monitor Exit";
+    case inflate_cause_lock_stack_full: return "Lock Stack Full";
     default:
       ShouldNotReachHere();
   }
@@ -1981,6 +1996,12 @@ void ObjectSynchronizer::audit_and_print_stats(outputStream* ls, bool on_exit) {
     log_in_use_monitor_details(ls, false /* log_all */);
   }
 
+  ls->print_cr("Inflations by cause:");
+  for (int i = 0; i < inflate_cause_nof; i++) {
+    InflateCause cause = (InflateCause)i;
+    ls->print_cr("  %-20s " SIZE_FORMAT, inflate_cause_name(cause), inflation_count(cause));
+  }
+
   ls->flush();
 
   guarantee(error_cnt == 0, "ERROR: found monitor list errors: error_cnt=%d", error_cnt);
@@ -79,7 +79,8 @@ class ObjectSynchronizer : AllStatic {
     inflate_cause_hash_code = 4,
     inflate_cause_jni_enter = 5,
     inflate_cause_jni_exit = 6,
-    inflate_cause_nof = 7 // Number of causes
+    inflate_cause_lock_stack_full = 7,
+    inflate_cause_nof = 8 // Number of causes
   } InflateCause;
 
   typedef enum {
@@ -133,6 +134,9 @@ class ObjectSynchronizer : AllStatic {
   static void inflate_helper(oop obj);
   static const char* inflate_cause_name(const InflateCause cause);
 
+  // Number of inflations per cause since VM start.
+  static size_t inflation_count(const InflateCause cause);
+
   // Returns the identity hash value for an oop
   // NOTE: It may cause monitor inflation
   static intptr_t FastHashCode(Thread* current, oop obj);
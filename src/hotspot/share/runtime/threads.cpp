@@ -41,6 +41,7 @@
 #include "gc/shared/gcVMOperations.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "gc/shared/softMaxHeapSizeUpdater.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm.h"
@@ -66,6 +67,7 @@
 #include "runtime/flags/jvmFlagLimit.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
@@ -776,6 +778,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     NativeHeapTrimmer::initialize();
   }
 
+  if (SoftMaxHeapSizeUpdater::enabled()) {
+    SoftMaxHeapSizeUpdater::initialize();
+  }
+
   // Always call even when there are not JVMTI environments yet, since environments
   // may be attached late and JVMTI must track phases of VM execution
   JvmtiExport::enter_live_phase();
@@ -1293,10 +1299,7 @@ class PrintOnClosure : public ThreadClosure {
   }
 };
 
-// Threads::print_on() is called at safepoint by VM_PrintThreads operation.
-void Threads::print_on(outputStream* st, bool print_stacks,
-                       bool internal_format, bool print_concurrent_locks,
-                       bool print_extended_info) {
+static void print_thread_dump_header(outputStream* st) {
   char buf[32];
   st->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
 
@@ -1305,6 +1308,13 @@ void Threads::print_on(outputStream* st, bool print_stacks,
                VM_Version::vm_release(),
                VM_Version::vm_info_string());
   st->cr();
+}
+
+// Threads::print_on() is called at safepoint by VM_PrintThreads operation.
+void Threads::print_on(outputStream* st, bool print_stacks,
+                       bool internal_format, bool print_concurrent_locks,
+                       bool print_extended_info) {
+  print_thread_dump_header(st);
 
 #if INCLUDE_SERVICES
   // Dump concurrent locks
@@ -1341,6 +1351,47 @@ void Threads::print_on(outputStream* st, bool print_stacks,
   st->flush();
 }
 
+class PrintThreadStackClosure : public HandshakeClosure {
+ private:
+  outputStream* _st;
+  bool _print_extended_info;
+
+ public:
+  PrintThreadStackClosure(outputStream* st, bool print_extended_info) :
+    HandshakeClosure("PrintThreadStack"),
+    _st(st),
+    _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    ResourceMark rm;
+    jt->print_on(_st, _print_extended_info);
+    jt->print_stack_on(_st);
+    _st->cr();
+  }
+};
+
+void Threads::print_on_with_handshakes(outputStream* st, bool print_extended_info) {
+  assert(!SafepointSynchronize::is_at_safepoint(), "use print_on() at a safepoint");
+  print_thread_dump_header(st);
+
+  ThreadsSMRSupport::print_info_on(st);
+  st->cr();
+
+  // The requesting thread stays blocked while a target runs the closure,
+  // so the output stream is never written to concurrently.
+  PrintThreadStackClosure stack_cl(st, print_extended_info);
+  ThreadsListHandle tlh;
+  for (JavaThread* jt : tlh) {
+    Handshake::execute(&stack_cl, &tlh, jt);
+  }
+
+  PrintOnClosure cl(st);
+  non_java_threads_do(&cl);
+
+  st->flush();
+}
+
 void Threads::print_on_error(Thread* this_thread, outputStream* st, Thread* current, char* buf,
                              int buflen, bool* found_current) {
   if (this_thread != nullptr) {
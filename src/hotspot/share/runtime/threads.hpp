@@ -121,6 +121,9 @@ class Threads: AllStatic {
   // Verification
   static void verify();
   static void print_on(outputStream* st, bool print_stacks, bool internal_format, bool print_concurrent_locks, bool print_extended_info);
+  // Like print_on() with stacks, but each JavaThread is stopped with its own
+  // handshake rather than all at a safepoint. The result is not an atomic snapshot.
+  static void print_on_with_handshakes(outputStream* st, bool print_extended_info);
   static void print(bool print_stacks, bool internal_format) {
     // this function is only used by debug.cpp
     print_on(tty, print_stacks, internal_format, false /* no concurrent lock printed */, false /* simple format */);
@@ -54,6 +54,8 @@
   template(GenCollectForAllocation)               \
   template(ParallelGCFailedAllocation)            \
   template(ParallelGCSystemGC)                    \
+  template(ParallelGCReleaseIdleYoung)            \
+  template(EpsilonArena)                          \
   template(G1CollectForAllocation)                \
   template(G1CollectFull)                         \
   template(G1PauseRemark)                         \
@@ -109,6 +111,8 @@
   template(PrintCompileQueue)                     \
   template(PrintClassHierarchy)                   \
   template(PrintClasses)                          \
+  template(PrintTrappingMethods)                  \
+  template(PrintInlineCacheMisses)                \
   template(ICBufferFull)                          \
   template(PrintMetadata)                         \
   template(GTestExecuteAtSafepoint)               \
@@ -32,6 +32,7 @@
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compilationRecords.hpp"
 #include "compiler/compiler_globals.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
@@ -48,6 +49,7 @@
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
@@ -55,6 +57,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threads.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -68,6 +71,9 @@
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/parseInteger.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#endif
 #ifdef LINUX
 #include "os_posix.hpp"
 #include "mallocInfoDcmd.hpp"
@@ -131,8 +137,11 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerTrapsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerStatisticsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeListDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<InlineCachesDCmd>(full_export, true, false));
 #ifdef LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfMapDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TrimCLibcHeapDCmd>(full_export, true, false));
@@ -168,6 +177,12 @@ void DCmd::register_dcmds(){
 #endif // INCLUDE_CDS
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<NMTDCmd>(full_export, true, false));
+
+#if INCLUDE_EPSILONGC
+  if (UseEpsilonGC) {
+    DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonArenaDCmd>(full_export, true, false));
+  }
+#endif // INCLUDE_EPSILONGC
 }
 
 HelpDCmd::HelpDCmd(outputStream* output, bool heap) : DCmdWithParser(output, heap),
@@ -558,15 +573,28 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "stop one thread at a time instead of all threads at a safepoint, "
+             "the stacks are not captured at the same point in time. Cannot be combined with -l",
+             "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
-  // thread stacks and JNI global handles
-  VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
-  VMThread::execute(&op1);
+  if (_handshake.value()) {
+    if (_locks.value()) {
+      output()->print_cr("-l requires a safepoint and cannot be used with -handshake");
+      return;
+    }
+    // thread stacks, one handshake per thread
+    Threads::print_on_with_handshakes(output(), _extended.value());
+  } else {
+    // thread stacks and JNI global handles
+    VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
+    VMThread::execute(&op1);
+  }
 
   // Deadlock detection
   VM_FindDeadlocks op2(output());
@@ -843,10 +871,76 @@ void CompileQueueDCmd::execute(DCmdSource source, TRAPS) {
   VMThread::execute(&printCompileQueueOp);
 }
 
+class VM_PrintWithLimit : public VM_Operation {
+private:
+  outputStream* _out;
+  int _limit;
+  void (*_print)(outputStream*, int);
+  VMOp_Type _type;
+public:
+  VM_PrintWithLimit(outputStream* out, int limit, void (*print)(outputStream*, int), VMOp_Type type) :
+    _out(out), _limit(limit), _print(print), _type(type) {}
+
+  virtual VMOp_Type type() const { return _type; }
+
+  virtual void doit() {
+    _print(_out, _limit);
+  }
+};
+
+CompilerLimitDCmd::CompilerLimitDCmd(outputStream* output, bool heap,
+                                     const char* limit_description, const char* default_limit) :
+  DCmdWithParser(output, heap),
+  _limit("limit", limit_description, "INT", false, default_limit)
+{
+  _dcmdparser.add_dcmd_argument(&_limit);
+}
+
+bool CompilerLimitDCmd::check_limit() {
+  jlong limit = _limit.value();
+  if (limit < 0 || limit > max_jint) {
+    output()->print_cr("Invalid limit: " JLONG_FORMAT, limit);
+    return false;
+  }
+  return true;
+}
+
+void CompilerLimitDCmd::print_at_safepoint(VM_Operation::VMOp_Type type, void (*print)(outputStream*, int)) {
+  VM_PrintWithLimit op(output(), limit(), print, type);
+  VMThread::execute(&op);
+}
+
+CompilerStatisticsDCmd::CompilerStatisticsDCmd(outputStream* output, bool heap) :
+  CompilerLimitDCmd(output, heap, "Maximum number of compilations to print", "50") {}
+
+void CompilerStatisticsDCmd::execute(DCmdSource source, TRAPS) {
+  if (check_limit()) {
+    CompilationRecords::print_on(output(), limit());
+  }
+}
+
+CompilerTrapsDCmd::CompilerTrapsDCmd(outputStream* output, bool heap) :
+  CompilerLimitDCmd(output, heap, "Maximum number of methods to print", "20") {}
+
+void CompilerTrapsDCmd::execute(DCmdSource source, TRAPS) {
+  if (check_limit()) {
+    print_at_safepoint(VM_Operation::VMOp_PrintTrappingMethods, Deoptimization::print_trapping_methods);
+  }
+}
+
 void CodeListDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_codelist(output());
 }
 
+InlineCachesDCmd::InlineCachesDCmd(outputStream* output, bool heap) :
+  CompilerLimitDCmd(output, heap, "Maximum number of call sites to print", "20") {}
+
+void InlineCachesDCmd::execute(DCmdSource source, TRAPS) {
+  if (check_limit()) {
+    print_at_safepoint(VM_Operation::VMOp_PrintInlineCacheMisses, CodeCache::print_inline_cache_misses);
+  }
+}
+
 void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_layout(output());
 }
@@ -426,8 +426,9 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
   static const char* description() {
@@ -556,6 +557,65 @@ class JMXStatusDCmd : public DCmd {
 
 };
 
+// Common part of the compiler commands that print the top entries of a
+// list, up to the number given by the optional limit argument.
+class CompilerLimitDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _limit;
+
+  CompilerLimitDCmd(outputStream* output, bool heap,
+                    const char* limit_description, const char* default_limit);
+
+  // Returns false, after reporting it, if the limit is out of range.
+  bool check_limit();
+  int limit() const { return (int)_limit.value(); }
+
+  // Runs print(output(), limit()) in a VM operation of the given type.
+  void print_at_safepoint(VM_Operation::VMOp_Type type, void (*print)(outputStream*, int));
+public:
+  static int num_arguments() { return 1; }
+};
+
+class CompilerStatisticsDCmd : public CompilerLimitDCmd {
+public:
+  CompilerStatisticsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.statistics";
+  }
+  static const char* description() {
+    return "Print the recent compilations that took the most CPU time.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class CompilerTrapsDCmd : public CompilerLimitDCmd {
+public:
+  CompilerTrapsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.traps";
+  }
+  static const char* description() {
+    return "Print the methods that took the most uncommon traps.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompileQueueDCmd : public DCmd {
 public:
   CompileQueueDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
@@ -621,6 +681,26 @@ class CodeListDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class InlineCachesDCmd : public CompilerLimitDCmd {
+public:
+  InlineCachesDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.inlinecaches";
+  }
+  static const char* description() {
+    return "Print the virtual call sites in compiled code with the most inline cache misses.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the size of the code cache.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CodeCacheDCmd : public DCmd {
 public:
   CodeCacheDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
@@ -2183,6 +2183,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   volatile int            _frame_serial_num;
 
   volatile int            _dump_seq;
+  // serial dump written straight into the target, without a segment file
+  bool                    _direct_dump;
   // parallel heap dump support
   uint                    _num_dumper_threads;
   DumperController*       _dumper_controller;
@@ -2231,8 +2233,11 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   // HPROF_TRACE and HPROF_FRAME records for platform and mounted virtual threads
   void dump_stack_traces(AbstractDumpWriter* writer);
 
+  // heap dump segment records written by each dumper
+  void dump_heap(DumpWriter* segment_writer, int dumper_id, uint worker_id);
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads, bool direct_dump) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -2248,7 +2253,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
     _frame_serial_num = 1;
 
     _dump_seq = VMDumperId;
-    _num_dumper_threads = num_dump_threads;
+    _direct_dump = direct_dump;
+    _num_dumper_threads = direct_dump ? 1 : num_dump_threads;
     _dumper_controller = nullptr;
     _poi = nullptr;
     if (oome) {
@@ -2279,7 +2285,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
     }
     delete _klass_map;
   }
-  int dump_seq()           { return _dump_seq; }
+  // number of segment files to merge
+  int dump_seq()           { return _direct_dump ? 0 : _dump_seq; }
   bool is_parallel_dump()  { return _num_dumper_threads > 1; }
   void prepare_parallel_dump(WorkerThreads* workers);
 
@@ -2474,56 +2481,20 @@ void VM_HeapDumper::work(uint worker_id) {
   // HPROF_HEAP_DUMP/HPROF_HEAP_DUMP_SEGMENT starts here
 
   ResourceMark rm;
-  // share global compressor, local DumpWriter is not responsible for its life cycle
-  DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
-                            writer()->is_overwrite(), writer()->compressor());
-  if (!segment_writer.has_error()) {
-    if (is_vm_dumper(dumper_id)) {
-      // dump some non-heap subrecords to heap dump segment
-      TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
-      // Writes HPROF_GC_CLASS_DUMP records
-      ClassDumper class_dumper(&segment_writer);
-      ClassLoaderDataGraph::classes_do(&class_dumper);
-
-      // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
-      dump_threads(&segment_writer);
-
-      // HPROF_GC_ROOT_JNI_GLOBAL
-      JNIGlobalsDumper jni_dumper(&segment_writer);
-      JNIHandles::oops_do(&jni_dumper);
-      // technically not jni roots, but global roots
-      // for things like preallocated throwable backtraces
-      Universe::vm_global()->oops_do(&jni_dumper);
-      // HPROF_GC_ROOT_STICKY_CLASS
-      // These should be classes in the null class loader data, and not all classes
-      // if !ClassUnloading
-      StickyClassDumper stiky_class_dumper(&segment_writer);
-      ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
-    }
-
-    // Heap iteration.
-    // writes HPROF_GC_INSTANCE_DUMP records.
-    // After each sub-record is written check_segment_length will be invoked
-    // to check if the current segment exceeds a threshold. If so, a new
-    // segment is started.
-    // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
-    // of the heap dump.
-
-    TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
-    HeapObjectDumper obj_dumper(&segment_writer, this);
-    if (!is_parallel_dump()) {
-      Universe::heap()->object_iterate(&obj_dumper);
-    } else {
-      // == Parallel dump
-      _poi->object_iterate(&obj_dumper, worker_id);
+  if (_direct_dump) {
+    assert(is_vm_dumper(dumper_id), "direct dump is serial");
+    dump_heap(writer(), dumper_id, worker_id);
+    _dumper_controller->dumper_complete(writer(), writer());
+  } else {
+    // share global compressor, local DumpWriter is not responsible for its life cycle
+    DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+                              writer()->is_overwrite(), writer()->compressor());
+    if (!segment_writer.has_error()) {
+      dump_heap(&segment_writer, dumper_id, worker_id);
     }
-
-    segment_writer.finish_dump_segment();
-    segment_writer.flush();
+    _dumper_controller->dumper_complete(&segment_writer, writer());
   }
 
-  _dumper_controller->dumper_complete(&segment_writer, writer());
-
   if (is_vm_dumper(dumper_id)) {
     _dumper_controller->wait_all_dumpers_complete();
 
@@ -2535,6 +2506,51 @@ void VM_HeapDumper::work(uint worker_id) {
   }
 }
 
+void VM_HeapDumper::dump_heap(DumpWriter* segment_writer, int dumper_id, uint worker_id) {
+  if (is_vm_dumper(dumper_id)) {
+    // dump some non-heap subrecords to heap dump segment
+    TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
+    // Writes HPROF_GC_CLASS_DUMP records
+    ClassDumper class_dumper(segment_writer);
+    ClassLoaderDataGraph::classes_do(&class_dumper);
+
+    // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
+    dump_threads(segment_writer);
+
+    // HPROF_GC_ROOT_JNI_GLOBAL
+    JNIGlobalsDumper jni_dumper(segment_writer);
+    JNIHandles::oops_do(&jni_dumper);
+    // technically not jni roots, but global roots
+    // for things like preallocated throwable backtraces
+    Universe::vm_global()->oops_do(&jni_dumper);
+    // HPROF_GC_ROOT_STICKY_CLASS
+    // These should be classes in the null class loader data, and not all classes
+    // if !ClassUnloading
+    StickyClassDumper stiky_class_dumper(segment_writer);
+    ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
+  }
+
+  // Heap iteration.
+  // writes HPROF_GC_INSTANCE_DUMP records.
+  // After each sub-record is written check_segment_length will be invoked
+  // to check if the current segment exceeds a threshold. If so, a new
+  // segment is started.
+  // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
+  // of the heap dump.
+
+  TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
+  HeapObjectDumper obj_dumper(segment_writer, this);
+  if (!is_parallel_dump()) {
+    Universe::heap()->object_iterate(&obj_dumper);
+  } else {
+    // == Parallel dump
+    _poi->object_iterate(&obj_dumper, worker_id);
+  }
+
+  segment_writer->finish_dump_segment();
+  segment_writer->flush();
+}
+
 void VM_HeapDumper::dump_stack_traces(AbstractDumpWriter* writer) {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer, HPROF_TRACE, 3 * sizeof(u4));
@@ -2586,6 +2602,11 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
 
   // write HPROF_TRACE/HPROF_FRAME records to global writer
   _dumper_controller->lock_global_writer();
+  if (segment_writer == writer()) {
+    // A direct dump shares the global writer, top-level records must not
+    // end up inside the current heap dump segment.
+    writer()->finish_dump_segment();
+  }
   thread_dumper.dump_stack_traces(writer(), _klass_map);
   _dumper_controller->unlock_global_writer();
 
@@ -2595,6 +2616,20 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   thread_dumper.dump_stack_refs(segment_writer);
 }
 
+// A FIFO or socket that already exists at path.
+static bool is_fifo_or_socket(const char* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return false;
+  }
+#ifdef S_ISSOCK
+  if (S_ISSOCK(st.st_mode)) {
+    return true;
+  }
+#endif
+  return S_ISFIFO(st.st_mode);
+}
+
 // dump the heap to given path.
 int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads) {
   assert(path != nullptr && strlen(path) > 0, "path missing");
@@ -2618,6 +2653,14 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     }
   }
 
+  // Segment files are created next to the target and merged into it afterwards,
+  // which does not work for a FIFO or socket. Stream a serial dump straight
+  // into those instead.
+  const bool direct_dump = is_fifo_or_socket(path);
+  if (direct_dump) {
+    log_info(heapdump)("Dumping heap to FIFO or socket %s without segment files", path);
+  }
+
   DumpWriter writer(path, overwrite, compressor);
 
   if (writer.error() != nullptr) {
@@ -2630,7 +2673,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   }
 
   // generate the segmented heap dump into separate files
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads, direct_dump);
   VMThread::execute(&dumper);
 
   // record any error that the writer may have encountered
@@ -33,6 +33,28 @@
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
+#ifndef _WINDOWS
+  struct stat st;
+  if (os::stat(_path, &st) == 0 && S_ISFIFO(st.st_mode)) {
+    // A blocking open of a FIFO waits for a reader to attach, but the dump is
+    // started in VM state or even at a safepoint. Fail instead if no reader
+    // is attached yet, and only then switch to blocking writes. Opening a
+    // FIFO cannot clobber any data, so 'overwrite' does not apply.
+    _fd = os::open(_path, O_WRONLY | O_NONBLOCK, 0);
+    if (_fd < 0) {
+      return errno == ENXIO ? "No reader attached to the FIFO" : os::strerror(errno);
+    }
+    const int flags = ::fcntl(_fd, F_GETFL);
+    if (flags == -1 || ::fcntl(_fd, F_SETFL, flags & ~O_NONBLOCK) == -1) {
+      const char* error = os::strerror(errno);
+      ::close(_fd);
+      _fd = -1;
+      return error;
+    }
+    return nullptr;
+  }
+#endif
+
   _fd = os::create_binary_file(_path, _overwrite);
 
   if (_fd < 0) {
@@ -61,6 +61,8 @@ class NativeCallStack : public StackObj {
 public:
 
   enum class FakeMarker { its_fake };
+  enum class UnsampledMarker { its_unsampled };
+  static constexpr uintptr_t _unsampled_address = -3; // 0xFF...FD
 #ifdef ASSERT
   static constexpr uintptr_t _fake_address = -2; // 0xFF...FE
   inline void assert_not_fake() const {
@@ -80,6 +82,12 @@ class NativeCallStack : public StackObj {
 #endif
   }
 
+  // Marks a malloc in NMT detail mode whose call stack was not sampled (see
+  // NMTDetailSampleInterval). Only the first frame is set.
+  explicit NativeCallStack(UnsampledMarker dummy) {
+    _stack[0] = (address)_unsampled_address;
+  }
+
   // Default ctor creates an empty stack.
   // (it may make sense to remove this altogether but its used in a few places).
   NativeCallStack() {
@@ -97,6 +105,10 @@ class NativeCallStack : public StackObj {
     return _stack[0] == nullptr;
   }
 
+  inline bool is_unsampled() const {
+    return _stack[0] == (address)_unsampled_address;
+  }
+
   // number of stack frames captured
   int frames() const;
 
@@ -128,5 +140,6 @@ class NativeCallStack : public StackObj {
 };
 
 #define FAKE_CALLSTACK NativeCallStack(NativeCallStack::FakeMarker::its_fake)
+#define UNSAMPLED_CALLSTACK NativeCallStack(NativeCallStack::UnsampledMarker::its_unsampled)
 
 #endif // SHARE_UTILITIES_NATIVECALLSTACK_HPP
@@ -57,6 +57,12 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/* The maximum size of a malloc-allocated buffer. Larger requests are
+ * handled in chunks of this size so that the temporary buffer stays
+ * below the allocator's mmap threshold and is reused across chunks.
+ */
+#define MAX_MALLOC_SIZE (64 * 1024)
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -92,6 +98,10 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return 0;
     } else if (len > BUF_SIZE) {
+        /* A short read is permitted, so never read more than one chunk */
+        if (len > MAX_MALLOC_SIZE) {
+            len = MAX_MALLOC_SIZE;
+        }
         buf = malloc(len);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
@@ -147,6 +157,7 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
            jint off, jint len, jboolean append, jfieldID fid)
 {
     jint n;
+    jint bufsize;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
     FD fd;
@@ -164,37 +175,48 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
+        bufsize = (len > MAX_MALLOC_SIZE) ? MAX_MALLOC_SIZE : len;
+        buf = malloc(bufsize);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
             return;
         }
     } else {
+        bufsize = BUF_SIZE;
         buf = stackBuf;
     }
 
-    (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
+    /* Copy and write the array slice one buffer-sized chunk at a time */
+    while (len > 0) {
+        jint chunk = (len > bufsize) ? bufsize : len;
+        jint pos = 0;
 
-    if (!(*env)->ExceptionOccurred(env)) {
-        off = 0;
-        while (len > 0) {
+        (*env)->GetByteArrayRegion(env, bytes, off, chunk, (jbyte *)buf);
+        if ((*env)->ExceptionOccurred(env)) {
+            break;
+        }
+        while (pos < chunk) {
             fd = getFD(env, this, fid);
             if (fd == -1) {
                 JNU_ThrowIOException(env, "Stream Closed");
                 break;
             }
             if (append == JNI_TRUE) {
-                n = IO_Append(fd, buf+off, len);
+                n = IO_Append(fd, buf+pos, chunk-pos);
             } else {
-                n = IO_Write(fd, buf+off, len);
+                n = IO_Write(fd, buf+pos, chunk-pos);
             }
             if (n == -1) {
                 JNU_ThrowIOExceptionWithLastError(env, "Write error");
                 break;
             }
-            off += n;
-            len -= n;
+            pos += n;
+        }
+        if (pos < chunk) {
+            break;
         }
+        off += chunk;
+        len -= chunk;
     }
     if (buf != stackBuf) {
         free(buf);
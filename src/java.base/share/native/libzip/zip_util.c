@@ -238,15 +238,42 @@ readFully(ZFILE zfd, void *buf, jlong len) {
 /*
  * Reads len bytes of data from the specified offset into buf.
  * Returns 0 if all bytes could be read, otherwise returns -1.
+ *
+ * Where available, positional reads are used so that the shared file
+ * offset of zfd is never modified and concurrent readers of the same
+ * zip file do not race on it.
  */
 static int
 readFullyAt(ZFILE zfd, void *buf, jlong len, jlong offset)
 {
+#ifdef WIN32
     if (IO_Lseek(zfd, offset, SEEK_SET) == -1) {
         return -1; /* lseek failure. */
     }
 
     return readFully(zfd, buf, len);
+#else
+    char *bp = (char *) buf;
+
+    while (len > 0) {
+        jlong limit = ((((jlong) 1) << 31) - 1);
+        jint count = (len < limit) ?
+            (jint) len :
+            (jint) limit;
+        ssize_t n = pread(zfd, bp, count, (off_t) offset);
+        if (n > 0) {
+            bp += n;
+            offset += n;
+            len -= n;
+        } else if (n == -1 && errno == EINTR) {
+          /* Retry after EINTR (interrupted by signal). */
+            continue;
+        } else { /* EOF or IO error */
+            return -1;
+        }
+    }
+    return 0;
+#endif
 }
 
 /*
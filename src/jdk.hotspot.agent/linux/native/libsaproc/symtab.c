@@ -46,6 +46,12 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // symbols with a name and a non-zero size, sorted by offset, and for
+  // each index the largest end offset of the symbols up to it; used for
+  // address to symbol lookups.
+  size_t num_sorted_symbols;
+  struct elf_symbol **sorted_symbols;
+  uintptr_t *sorted_max_ends;
 } symtab_t;
 
 
@@ -288,6 +294,49 @@ static struct symtab* build_symtab_from_build_id(Elf64_Nhdr *note)
   return symtab;
 }
 
+// order symbols by offset, and symbols at the same offset by their
+// position in the symbol table.
+static int sym_cmp_offset(const void *a, const void *b) {
+  const struct elf_symbol *s1 = *(struct elf_symbol * const *)a;
+  const struct elf_symbol *s2 = *(struct elf_symbol * const *)b;
+  if (s1->offset != s2->offset) {
+    return s1->offset < s2->offset ? -1 : 1;
+  }
+  return s1 < s2 ? -1 : (s1 > s2 ? 1 : 0);
+}
+
+// build the sorted address index used by nearest_symbol.
+static bool build_sorted_symbols(struct symtab* symtab) {
+  size_t j, cnt = 0;
+  uintptr_t max_end = 0;
+
+  symtab->sorted_symbols = (struct elf_symbol **)
+      calloc(symtab->num_symbols, sizeof(struct elf_symbol *));
+  symtab->sorted_max_ends = (uintptr_t *)
+      calloc(symtab->num_symbols, sizeof(uintptr_t));
+  if (symtab->sorted_symbols == NULL || symtab->sorted_max_ends == NULL) {
+    return false;
+  }
+
+  for (j = 0; j < symtab->num_symbols; j++) {
+    struct elf_symbol* sym = &(symtab->symbols[j]);
+    if (sym->name != NULL && sym->size > 0) {
+      symtab->sorted_symbols[cnt++] = sym;
+    }
+  }
+  symtab->num_sorted_symbols = cnt;
+  qsort(symtab->sorted_symbols, cnt, sizeof(struct elf_symbol *), sym_cmp_offset);
+
+  for (j = 0; j < cnt; j++) {
+    struct elf_symbol* sym = symtab->sorted_symbols[j];
+    if (sym->offset + sym->size > max_end) {
+      max_end = sym->offset + sym->size;
+    }
+    symtab->sorted_max_ends[j] = max_end;
+  }
+  return true;
+}
+
 // read symbol table from given fd.  If try_debuginfo) is true, also
 // try to open an associated debuginfo file
 static struct symtab* build_symtab_internal(int fd, const char *filename, bool try_debuginfo) {
@@ -442,6 +491,10 @@ static struct symtab* build_symtab_internal(int fd, const char *filename, bool t
         item.data = (void *)&(symtab->symbols[j]);
         hsearch_r(item, ENTER, &ret, symtab->hash_table);
       }
+
+      if (!build_sorted_symbols(symtab)) {
+        goto bad;
+      }
     }
   }
 
@@ -519,6 +572,8 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->sorted_symbols) free(symtab->sorted_symbols);
+  if (symtab->sorted_max_ends) free(symtab->sorted_max_ends);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -552,15 +607,37 @@ uintptr_t search_symbol(struct symtab* symtab, uintptr_t base,
 
 const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
-  int n = 0;
-  if (!symtab) return NULL;
-  for (; n < symtab->num_symbols; n++) {
-     struct elf_symbol* sym = &(symtab->symbols[n]);
-     if (sym->name != NULL &&
-         offset >= sym->offset && offset < sym->offset + sym->size) {
-        if (poffset) *poffset = (offset - sym->offset);
-        return sym->name;
-     }
+  size_t lo = 0, hi;
+  struct elf_symbol* found = NULL;
+  if (!symtab || !symtab->sorted_symbols) return NULL;
+
+  // find the first symbol starting after offset
+  hi = symtab->num_sorted_symbols;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (symtab->sorted_symbols[mid]->offset <= offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // walk back over the symbols that may still cover offset, until none
+  // up to the current index ends after offset. If several cover offset,
+  // prefer the one that comes first in the symbol table.
+  while (lo > 0) {
+    struct elf_symbol* sym = symtab->sorted_symbols[--lo];
+    if (symtab->sorted_max_ends[lo] <= offset) {
+      break;
+    }
+    if (offset < sym->offset + sym->size && (found == NULL || sym < found)) {
+      found = sym;
+    }
+  }
+
+  if (found != NULL) {
+    if (poffset) *poffset = (offset - found->offset);
+    return found->name;
   }
   return NULL;
 }
@@ -89,6 +89,7 @@ static bool sort_map_array(struct ps_prochandle* ph) {
   if (ph->core->map_array) {
     free(ph->core->map_array);
   }
+  ph->core->last_map = NULL;
   ph->core->map_array = array;
   // sort the map_info array by base virtual address.
   qsort(ph->core->map_array, ph->core->num_maps, sizeof (map_info*),
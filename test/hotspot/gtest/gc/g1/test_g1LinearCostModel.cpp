@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearCostModel.hpp"
+#include "unittest.hpp"
+
+static const double epsilon = 1e-6;
+
+TEST_VM(G1LinearCostModel, exact_fit) {
+  G1LinearCostModel model(0.9);
+  ASSERT_FALSE(model.has_fit());
+
+  // time = 2.0 + 0.5 * units
+  model.add(10.0, 7.0);
+  model.add(20.0, 12.0);
+  model.add(40.0, 22.0);
+  ASSERT_TRUE(model.has_fit());
+
+  ASSERT_NEAR(model.fixed_cost(), 2.0, epsilon);
+  ASSERT_NEAR(model.unit_cost(), 0.5, epsilon);
+  ASSERT_NEAR(model.residual_stddev(), 0.0, epsilon);
+  ASSERT_NEAR(model.predict(100.0, 1.0), 52.0, epsilon);
+  ASSERT_NEAR(model.predict_variable_cost(100.0, 1.0), 50.0, epsilon);
+}
+
+TEST_VM(G1LinearCostModel, constant_units_falls_back_to_unit_cost) {
+  G1LinearCostModel model(0.9);
+
+  for (int i = 0; i < 5; i++) {
+    model.add(100.0, 25.0);
+  }
+  ASSERT_NEAR(model.fixed_cost(), 0.0, epsilon);
+  ASSERT_NEAR(model.unit_cost(), 0.25, epsilon);
+}
+
+TEST_VM(G1LinearCostModel, negative_fixed_cost_falls_back_to_unit_cost) {
+  G1LinearCostModel model(0.9);
+
+  // A linear fit of these samples has a negative intercept.
+  model.add(10.0, 1.0);
+  model.add(20.0, 8.0);
+  model.add(30.0, 15.0);
+  ASSERT_NEAR(model.fixed_cost(), 0.0, epsilon);
+  ASSERT_GT(model.unit_cost(), 0.0);
+}
+
+TEST_VM(G1LinearCostModel, noise_increases_prediction) {
+  G1LinearCostModel model(0.9);
+
+  model.add(10.0, 6.0);
+  model.add(20.0, 13.0);
+  model.add(30.0, 16.0);
+  model.add(40.0, 23.0);
+  ASSERT_GT(model.unit_cost_stddev(), 0.0);
+  ASSERT_GT(model.predict(50.0, 1.0), model.predict(50.0, 0.0));
+}
+
+TEST_VM(G1LinearCostModel, adapts_to_change) {
+  G1LinearCostModel model(0.5);
+
+  for (int i = 0; i < 10; i++) {
+    model.add(10.0 + i, 1.0 * (10.0 + i));
+  }
+  for (int i = 0; i < 40; i++) {
+    model.add(10.0 + (i % 10), 2.0 * (10.0 + (i % 10)));
+  }
+  ASSERT_NEAR(model.unit_cost(), 2.0, 1e-3);
+}
+
+TEST_VM(G1PhaseDependentCostModel, mixed_uses_young_until_fit) {
+  G1PhaseDependentCostModel model(0.9);
+
+  model.add(10.0, 10.0, true /* for_young_only_phase */);
+  model.add(20.0, 20.0, true /* for_young_only_phase */);
+  model.add(30.0, 30.0, true /* for_young_only_phase */);
+  ASSERT_TRUE(model.has_fit(false /* for_young_only_phase */));
+  ASSERT_NEAR(model.predict_variable_cost(10.0, 0.0, false /* for_young_only_phase */), 10.0, epsilon);
+
+  model.add(10.0, 20.0, false /* for_young_only_phase */);
+  model.add(20.0, 40.0, false /* for_young_only_phase */);
+  model.add(30.0, 60.0, false /* for_young_only_phase */);
+  ASSERT_NEAR(model.predict_variable_cost(10.0, 0.0, false /* for_young_only_phase */), 20.0, epsilon);
+  ASSERT_NEAR(model.predict_variable_cost(10.0, 0.0, true /* for_young_only_phase */), 10.0, epsilon);
+}
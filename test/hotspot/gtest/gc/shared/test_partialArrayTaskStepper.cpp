@@ -24,7 +24,9 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/partialArrayTaskStepper.inline.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "memory/allStatic.hpp"
+#include "utilities/autoRestore.hpp"
 #include "unittest.hpp"
 
 using Step = PartialArrayTaskStepper::Step;
@@ -85,3 +87,26 @@ TEST(PartialArrayTaskStepperTest, doit) {
     }
   }
 }
+
+TEST(PartialArrayTaskStepperTest, chunk_size) {
+  {
+    AutoModifyRestore<bool> f(UseAdaptivePartialArrayChunkSize, false);
+    ASSERT_EQ(50, Stepper::chunk_size_for(100000000, 50, 16));
+  }
+  AutoModifyRestore<bool> f(UseAdaptivePartialArrayChunkSize, true);
+  // Small arrays use the minimum chunk size.
+  ASSERT_EQ(50, Stepper::chunk_size_for(0, 50, 16));
+  ASSERT_EQ(50, Stepper::chunk_size_for(1000, 50, 16));
+  for (uint n_workers = 1; n_workers <= 256; n_workers *= 2) {
+    for (int length = 1; length <= (INT_MAX / 3); length *= 3) {
+      const int chunk_size = Stepper::chunk_size_for(length, 50, n_workers);
+      ASSERT_GE(chunk_size, 50);
+      ASSERT_LE(chunk_size, MAX2(length, 50));
+      // Chunk size does not decrease with growing length.
+      ASSERT_LE(chunk_size, Stepper::chunk_size_for(length * 2, 50, n_workers));
+      if (length <= 10000000) {
+        run_test(length, chunk_size, n_workers);
+      }
+    }
+  }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/plab.hpp"
+#include "unittest.hpp"
+
+TEST_VM(PLABWorkerSizing, no_history) {
+  PLABWorkerSizing sizing(4, 75, 50);
+  for (uint i = 0; i < 4; i++) {
+    EXPECT_EQ(0u, sizing.desired_plab_size(i));
+  }
+  // Workers beyond the maximum are ignored.
+  sizing.record(4, 1000);
+  EXPECT_EQ(0u, sizing.desired_plab_size(4));
+}
+
+TEST_VM(PLABWorkerSizing, per_worker) {
+  PLABWorkerSizing sizing(2, 75, 50);
+
+  const size_t small_used = PLAB::min_size() * 100;
+  const size_t large_used = small_used * 4;
+  sizing.record(0, small_used);
+  sizing.record(1, large_used);
+
+  const size_t small_size = sizing.desired_plab_size(0);
+  const size_t large_size = sizing.desired_plab_size(1);
+
+  EXPECT_GE(small_size, PLAB::min_size());
+  EXPECT_LE(large_size, PLAB::max_size());
+  EXPECT_TRUE(is_object_aligned(small_size));
+  EXPECT_TRUE(is_object_aligned(large_size));
+  if (large_size < PLAB::max_size()) {
+    EXPECT_GT(large_size, small_size);
+  }
+
+  // The size allows wasting TargetPLABWastePct with the last buffer half-full.
+  const size_t expected = align_object_size(clamp(small_used * TargetPLABWastePct / 50,
+                                                  PLAB::min_size(), PLAB::max_size()));
+  EXPECT_EQ(expected, small_size);
+}
@@ -355,14 +355,28 @@ TEST_VM(Arena, Arena_grows_large_unaligned) {
 static size_t random_arena_chunk_size() {
   // Return with a 50% rate a standard size, otherwise some random size
   if (os::random() % 10 < 5) {
-    static const size_t standard_sizes[4] = {
-        Chunk::tiny_size, Chunk::init_size, Chunk::size, Chunk::medium_size
+    static const size_t standard_sizes[6] = {
+        Chunk::tiny_size, Chunk::init_size, Chunk::size, Chunk::medium_size,
+        Chunk::large_size, Chunk::huge_size
     };
-    return standard_sizes[os::random() % 4];
+    return standard_sizes[os::random() % 6];
   }
   return ARENA_ALIGN(os::random() % 1024);
 }
 
+TEST_VM(Arena, oversized_grow_uses_size_class) {
+  // Growth requests slightly larger than the default chunk size are rounded
+  // up to the next pooled size class.
+  Arena ar(mtTest, Arena::Tag::tag_other, 100);
+  const size_t first = ar.size_in_bytes();
+  void* p = ar.Amalloc(Chunk::size + 8);
+  ASSERT_NOT_NULL(p);
+  ASSERT_EQ(first + Chunk::large_size, ar.size_in_bytes());
+  p = ar.Amalloc(Chunk::large_size + 8);
+  ASSERT_NOT_NULL(p);
+  ASSERT_EQ(first + Chunk::large_size + Chunk::huge_size, ar.size_in_bytes());
+}
+
 TEST_VM(Arena, different_chunk_sizes) {
   // Test the creation/pooling of chunks; since ChunkPool is hidden, the
   //  only way to test this is to create/destroy arenas with different init sizes,
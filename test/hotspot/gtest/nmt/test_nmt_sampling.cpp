@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "nmt/mallocSiteTable.hpp"
+#include "nmt/memTracker.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals.hpp"
+#include "unittest.hpp"
+
+TEST_VM(NMT, sample_malloc_call_stack_default) {
+  AutoSaveRestore<uintx> FLAG_GUARD(NMTDetailSampleInterval);
+  NMTDetailSampleInterval = 1;
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(MemTracker::sample_malloc_call_stack());
+  }
+}
+
+TEST_VM(NMT, sample_malloc_call_stack_rate) {
+  AutoSaveRestore<uintx> FLAG_GUARD(NMTDetailSampleInterval);
+  NMTDetailSampleInterval = 16;
+  const int calls = 16 * 10000;
+  int sampled = 0;
+  for (int i = 0; i < calls; i++) {
+    if (MemTracker::sample_malloc_call_stack()) {
+      sampled++;
+    }
+  }
+  // Expect about one in 16 calls to be sampled.
+  EXPECT_GT(sampled, 9000);
+  EXPECT_LT(sampled, 11000);
+}
+
+TEST_VM(NMT, malloc_site_scale) {
+  NativeCallStack stack;
+  MallocSite site(stack, mtTest);
+  site.allocate(100);
+  site.allocate(100);
+  site.deallocate(100);
+  site.scale(4);
+  EXPECT_EQ(400u, site.size());
+  EXPECT_EQ(4u, site.count());
+  // The peak is scaled as well, not raised to the scaled current size.
+  EXPECT_EQ(800u, site.peak_size());
+  EXPECT_EQ(8u, site.counter()->peak_count());
+}
+
+TEST(NMT, unsampled_call_stack) {
+  EXPECT_TRUE(UNSAMPLED_CALLSTACK.is_unsampled());
+  EXPECT_FALSE(NativeCallStack().is_unsampled());
+  EXPECT_FALSE(NativeCallStack(0).is_unsampled());
+}
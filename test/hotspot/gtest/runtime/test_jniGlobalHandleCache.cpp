@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "runtime/jniHandles.hpp"
+#include "unittest.hpp"
+
+class JNIGlobalHandleCacheTest : public ::testing::Test {
+protected:
+  OopStorage* _storage;
+
+  JNIGlobalHandleCacheTest() :
+    _storage(OopStorage::create("Test JNI Global Handle Cache", mtInternal)) {}
+
+  ~JNIGlobalHandleCacheTest() {
+    delete _storage;
+  }
+};
+
+TEST_VM_F(JNIGlobalHandleCacheTest, allocate_and_release) {
+  const size_t num_entries = 100;
+  oop* entries[num_entries];
+  JNIGlobalHandleCache cache;
+
+  for (size_t i = 0; i < num_entries; ++i) {
+    entries[i] = cache.allocate(_storage);
+    ASSERT_NE(entries[i], (oop*)nullptr);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage->allocation_status(entries[i]));
+    for (size_t j = 0; j < i; ++j) {
+      ASSERT_NE(entries[i], entries[j]);
+    }
+  }
+  // Entries still in the cache are allocated in the storage too.
+  EXPECT_EQ(num_entries + cache.count(), _storage->allocation_count());
+
+  _storage->release(entries, num_entries);
+  EXPECT_EQ(cache.count(), _storage->allocation_count());
+
+  cache.release_all(_storage);
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(0u, _storage->allocation_count());
+}
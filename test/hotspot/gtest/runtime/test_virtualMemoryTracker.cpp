@@ -35,6 +35,7 @@
 #include "memory/virtualspace.hpp"
 #include "nmt/memTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/threadCritical.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "unittest.hpp"
@@ -546,6 +547,49 @@ class VirtualMemoryTrackerTest {
       check_empty(rmr);
     }
   }
+
+  static void test_alternating_reserved_regions() {
+    size_t size  = 0x01000000;
+    ReservedSpace rs1(size);
+    ReservedSpace rs2(size);
+    address addr1 = (address)rs1.base();
+    address addr2 = (address)rs2.base();
+
+    address frame = (address)0x1234;
+    NativeCallStack stack(&frame, 1);
+
+    ReservedMemoryRegion* rmr1 = VirtualMemoryTracker::_reserved_regions->find(ReservedMemoryRegion(addr1, size));
+    ReservedMemoryRegion* rmr2 = VirtualMemoryTracker::_reserved_regions->find(ReservedMemoryRegion(addr2, size));
+    ASSERT_NE(rmr1, rmr2);
+
+    const size_t cs = 0x1000;
+
+    // Alternate between the two reservations, each lookup must resolve to
+    // the right region regardless of which one was found last.
+    {
+      ThreadCritical tc;
+      for (size_t i = 0; i < 4; i++) {
+        VirtualMemoryTracker::add_committed_region(addr1 + 2 * i * cs, cs, stack);
+        VirtualMemoryTracker::add_committed_region(addr2 + i * cs, cs, stack);
+      }
+    }
+
+    R r1[] = { {addr1,          cs},
+               {addr1 + 2 * cs, cs},
+               {addr1 + 4 * cs, cs},
+               {addr1 + 6 * cs, cs} };
+    check(rmr1, r1);
+    R r2[] = { {addr2, 4 * cs} };
+    check(rmr2, r2);
+
+    {
+      ThreadCritical tc;
+      VirtualMemoryTracker::remove_uncommitted_region(addr1, 8 * cs);
+      VirtualMemoryTracker::remove_uncommitted_region(addr2, 4 * cs);
+    }
+    check_empty(rmr1);
+    check_empty(rmr2);
+  }
 };
 
 TEST_VM(NMT_VirtualMemoryTracker, add_committed_region) {
@@ -563,3 +607,11 @@ TEST_VM(NMT_VirtualMemoryTracker, remove_uncommitted_region) {
     tty->print_cr("skipped.");
   }
 }
+
+TEST_VM(NMT_VirtualMemoryTracker, alternating_reserved_regions) {
+  if (MemTracker::tracking_level() >= NMT_detail) {
+    VirtualMemoryTrackerTest::test_alternating_reserved_regions();
+  } else {
+    tty->print_cr("skipped.");
+  }
+}
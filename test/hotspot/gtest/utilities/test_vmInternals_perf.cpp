@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/arena.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+#include "unittest.hpp"
+
+// These "tests" don't really verify much.  Rather, they are
+// microbenchmarks for frequently used VM-internal data structures.
+// Each one times a fixed number of operations and prints the average
+// cost per operation, so that changes to these structures can be
+// compared before and after.  The amount of work is kept small enough
+// for them to run along with the other gtests.
+
+static void print_perf(const char* name, Tickspan duration, size_t ops) {
+  double ns_per_op = (double)duration.nanoseconds() / (double)ops;
+  tty->print_cr("%-36s " SIZE_FORMAT " ops, %8.2f ns/op", name, ops, ns_per_op);
+}
+
+struct PerfCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)(value * 0x9E3779B97F4A7C15ULL);
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return os::malloc(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    os::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<PerfCHTConfig, mtTest> PerfCHT;
+
+struct PerfCHTLookup {
+  uintptr_t _val;
+  PerfCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return PerfCHTConfig::get_hash(_val, nullptr);
+  }
+  bool equals(const uintptr_t* value) {
+    return _val == *value;
+  }
+  bool is_dead(const uintptr_t* value) {
+    return false;
+  }
+};
+
+struct PerfCHTFound {
+  uintptr_t _sum;
+  PerfCHTFound() : _sum(0) {}
+  void operator()(uintptr_t* value) {
+    _sum += *value;
+  }
+};
+
+TEST_VM(VMInternalsPerf, concurrent_hash_table) {
+  const uintptr_t entries = 100000;
+  Thread* thr = Thread::current();
+  PerfCHT* cht = new PerfCHT(17);
+
+  Ticks start = Ticks::now();
+  for (uintptr_t v = 1; v <= entries; v++) {
+    PerfCHTLookup lookup(v);
+    EXPECT_TRUE(cht->insert(thr, lookup, v));
+  }
+  print_perf("ConcurrentHashTable insert", Ticks::now() - start, entries);
+
+  PerfCHTFound found;
+  start = Ticks::now();
+  for (uintptr_t v = 1; v <= entries; v++) {
+    PerfCHTLookup lookup(v);
+    cht->get(thr, lookup, found);
+  }
+  print_perf("ConcurrentHashTable get", Ticks::now() - start, entries);
+  EXPECT_EQ(found._sum, entries * (entries + 1) / 2);
+
+  delete cht;
+}
+
+TEST_VM(VMInternalsPerf, task_queue_push_pop) {
+  typedef GenericTaskQueue<int, mtTest> PerfTaskQueue;
+  const int rounds = 100;
+  const int batch = 1000;
+  PerfTaskQueue* queue = new PerfTaskQueue();
+  int sum = 0;
+
+  Ticks start = Ticks::now();
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < batch; i++) {
+      queue->push(i);
+    }
+    int t;
+    while (queue->pop_local(t)) {
+      sum += t;
+    }
+  }
+  print_perf("GenericTaskQueue push+pop_local", Ticks::now() - start, (size_t)rounds * batch);
+  EXPECT_EQ(sum, rounds * (batch * (batch - 1) / 2));
+
+  start = Ticks::now();
+  for (int i = 0; i < batch; i++) {
+    queue->push(i);
+  }
+  int t;
+  int stolen = 0;
+  while (queue->pop_global(t) == PerfTaskQueue::PopResult::Success) {
+    stolen++;
+  }
+  print_perf("GenericTaskQueue push+pop_global", Ticks::now() - start, (size_t)batch);
+  EXPECT_EQ(stolen, batch);
+
+  delete queue;
+}
+
+TEST_VM(VMInternalsPerf, bitmap_iterate) {
+  const BitMap::idx_t size = 1024 * 1024;
+  ResourceMark rm;
+  ResourceBitMap map(size);
+  for (BitMap::idx_t i = 0; i < size; i += 7) {
+    map.set_bit(i);
+  }
+
+  size_t count = 0;
+  Ticks start = Ticks::now();
+  map.iterate([&](BitMap::idx_t index) {
+    count++;
+    return true;
+  });
+  print_perf("BitMap iterate (1 in 7 set)", Ticks::now() - start, (size_t)size);
+  EXPECT_EQ(count, (size_t)((size + 6) / 7));
+}
+
+TEST_VM(VMInternalsPerf, arena_allocate) {
+  const size_t allocs = 100000;
+  Arena arena(mtTest);
+
+  Ticks start = Ticks::now();
+  for (size_t i = 0; i < allocs; i++) {
+    void* p = arena.Amalloc(16 + (i % 8) * 8);
+    ASSERT_NE(p, (void*)nullptr);
+  }
+  print_perf("Arena Amalloc (16-72 bytes)", Ticks::now() - start, allocs);
+}
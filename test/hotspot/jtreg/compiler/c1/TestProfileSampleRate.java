@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that sampled C1 branch profiling records both directions of
+ *          a branch that alternates with a period related to the sample rate
+ * @requires vm.compiler1.enabled
+ * @library /test/lib
+ * @run driver compiler.c1.TestProfileSampleRate
+ */
+
+package compiler.c1;
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestProfileSampleRate {
+    static final int ITERATIONS = 100_000;
+
+    static int sinkA;
+    static int sinkB;
+
+    // The only profiled branch executed in compiled code. It alternates on
+    // every call, so with a sample countdown reset to a fixed even value only
+    // one direction would ever be recorded.
+    static void branch(boolean b) {
+        if (b) {
+            sinkA++;
+        } else {
+            sinkB++;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            for (int i = 0; i < ITERATIONS; i++) {
+                branch((i & 1) == 0);
+            }
+            return;
+        }
+
+        for (int rate : new int[] {2, 4, 16}) {
+            check(rate);
+        }
+    }
+
+    static void check(int rate) throws Exception {
+        // Only branch() is compiled, at tier 3 before its first execution, so
+        // the interpreter does not contribute to its profile.
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-Xcomp",
+            "-XX:TieredStopAtLevel=3",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + TestProfileSampleRate.class.getName() + "::branch",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:C1ProfileSampleRate=" + rate,
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintMethodData",
+            TestProfileSampleRate.class.getName(), "run");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String out = output.getStdout();
+        int start = out.indexOf(TestProfileSampleRate.class.getName() + "::branch(Z)V");
+        if (start < 0) {
+            throw new RuntimeException("No profile printed for branch()");
+        }
+        int end = out.indexOf("-----", start);
+        String profile = out.substring(start, end < 0 ? out.length() : end);
+
+        Matcher taken = Pattern.compile("taken\\((\\d+)\\) displacement").matcher(profile);
+        Matcher notTaken = Pattern.compile("not taken\\((\\d+)\\)").matcher(profile);
+        if (!taken.find() || !notTaken.find()) {
+            throw new RuntimeException("No BranchData for branch():\n" + profile);
+        }
+        long takenCount = Long.parseLong(taken.group(1));
+        long notTakenCount = Long.parseLong(notTaken.group(1));
+        System.out.println("rate " + rate + ": taken " + takenCount + ", not taken " + notTakenCount);
+
+        // Both directions run ITERATIONS / 2 times; allow for sampling noise.
+        long expected = ITERATIONS / 2;
+        checkCount("taken", rate, takenCount, expected);
+        checkCount("not taken", rate, notTakenCount, expected);
+    }
+
+    static void checkCount(String what, int rate, long count, long expected) {
+        if (count < expected / 2 || count > expected * 2) {
+            throw new RuntimeException("rate " + rate + ": " + what + " count " + count +
+                                       " too far from " + expected);
+        }
+    }
+}
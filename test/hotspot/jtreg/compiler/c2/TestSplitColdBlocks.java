@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that splitting uncommon blocks into a cold tail preserves
+ *          the semantics of rarely executed paths.
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSplitColdBlocks::test*
+ *                   compiler.c2.TestSplitColdBlocks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+BlockLayoutSplitColdBlocks
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSplitColdBlocks::test*
+ *                   compiler.c2.TestSplitColdBlocks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+BlockLayoutSplitColdBlocks
+ *                   -XX:+StressLCM -XX:+StressGCM
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSplitColdBlocks::test*
+ *                   compiler.c2.TestSplitColdBlocks
+ */
+public class TestSplitColdBlocks {
+    static final int ITERATIONS = 50_000;
+    static final int RARE = 4096;
+
+    static int[] array = new int[16];
+    static int sink;
+
+    // Rarely taken branches in the middle of a hot loop
+    static int testRareBranch(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            if ((i & (RARE - 1)) == RARE - 1) {
+                sum += slowPath(i);
+            } else {
+                sum += i;
+            }
+        }
+        return sum;
+    }
+
+    static int slowPath(int i) {
+        return -i * 3;
+    }
+
+    // Exception handler that is only reached at the very end
+    static int testRareException(int[] a, int n) {
+        int sum = 0;
+        try {
+            for (int i = 0; i < n; i++) {
+                sum += a[i & 15];
+                if (i == n - 1 && n > ITERATIONS) {
+                    sum += a[a.length];
+                }
+            }
+        } catch (ArrayIndexOutOfBoundsException e) {
+            sum = -sum;
+        }
+        return sum;
+    }
+
+    // Uncommon trap taken only after compilation
+    static int testUncommonTrap(Object o) {
+        if (o instanceof Integer i) {
+            return i + 1;
+        }
+        return o.hashCode() & 0;
+    }
+
+    static int expectedRareBranch(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += ((i & (RARE - 1)) == RARE - 1) ? -i * 3 : i;
+        }
+        return sum;
+    }
+
+    static void check(int expected, int actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + ", got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < array.length; i++) {
+            array[i] = i;
+        }
+        int expectedRare = expectedRareBranch(RARE * 2);
+        for (int i = 0; i < ITERATIONS; i++) {
+            check(expectedRare, testRareBranch(RARE * 2), "testRareBranch");
+            sink += testRareException(array, 64);
+            check(i + 1, testUncommonTrap(i), "testUncommonTrap");
+        }
+        int sum = 0;
+        for (int i = 0; i < ITERATIONS + 1; i++) {
+            sum += array[i & 15];
+        }
+        check(-sum, testRareException(array, ITERATIONS + 1), "testRareException");
+        check(0, testUncommonTrap("x"), "testUncommonTrap");
+    }
+}
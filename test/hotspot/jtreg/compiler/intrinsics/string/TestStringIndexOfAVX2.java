@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Correctness of the AVX2 String.indexOf intrinsic for Latin1 and
+ *          UTF16 substrings around its length threshold
+ * @requires vm.compiler2.enabled & os.arch == "amd64"
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseAVX2StringIndexOf compiler.intrinsics.string.TestStringIndexOfAVX2
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:-UseAVX2StringIndexOf compiler.intrinsics.string.TestStringIndexOfAVX2
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:UseAVX=1
+ *                   compiler.intrinsics.string.TestStringIndexOfAVX2
+ */
+
+package compiler.intrinsics.string;
+
+import java.util.Random;
+
+public class TestStringIndexOfAVX2 {
+    // Substring lengths in chars around the thresholds of 16 (LL) and 8 (UU)
+    // chars, and around the 32 (LL) and 16 (UU) positions of one vector step.
+    static final int[] SUB_LENGTHS = {1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 48, 64, 65};
+    static final int MAX_LENGTH = 160;
+    static final int WARMUP = 20;
+
+    static final Random RANDOM = new Random(12345);
+
+    static int indexOf(String s, String sub) {
+        return s.indexOf(sub);
+    }
+
+    static int indexOf(String s, String sub, int from) {
+        return s.indexOf(sub, from);
+    }
+
+    static int reference(String s, String sub, int from) {
+        from = Math.max(from, 0);
+        for (int i = from; i <= s.length() - sub.length(); i++) {
+            if (s.regionMatches(i, sub, 0, sub.length())) {
+                return i;
+            }
+        }
+        return sub.isEmpty() && from <= s.length() ? from : -1;
+    }
+
+    // Strings over a two letter alphabet, so that the first and last
+    // substring elements often match where the middle does not.
+    static String random(int length, char base) {
+        char[] chars = new char[length];
+        for (int i = 0; i < length; i++) {
+            chars[i] = (char)(base + RANDOM.nextInt(2));
+        }
+        return new String(chars);
+    }
+
+    static String replace(String s, int pos, String sub) {
+        return s.substring(0, pos) + sub + s.substring(pos + sub.length());
+    }
+
+    static void check(String s, String sub) {
+        int expected = reference(s, sub, 0);
+        int actual = indexOf(s, sub);
+        if (actual != expected) {
+            throw new RuntimeException("indexOf(\"" + s + "\", \"" + sub + "\") = " + actual +
+                                       ", expected " + expected);
+        }
+        int from = s.length() / 3;
+        expected = reference(s, sub, from);
+        actual = indexOf(s, sub, from);
+        if (actual != expected) {
+            throw new RuntimeException("indexOf(\"" + s + "\", \"" + sub + "\", " + from + ") = " +
+                                       actual + ", expected " + expected);
+        }
+    }
+
+    static void test(char base) {
+        // base 'a' gives Latin1 strings (LL), base '\u0100' gives UTF16 strings (UU)
+        char other = (char)(base + 2);
+        for (int subLength : SUB_LENGTHS) {
+            String sub = random(subLength, base);
+            // A near miss: first and last elements match, one in the middle differs.
+            String nearMiss = subLength > 2 ? replace(sub, subLength / 2, String.valueOf(other)) : sub;
+            for (int length = subLength; length <= MAX_LENGTH; length++) {
+                String filler = random(length, base);
+                String blank = filler.replace(base, other).replace((char)(base + 1), other);
+
+                // Not found, not even a partial match
+                check(blank, sub);
+
+                // Near misses only, unless the substring is too short to differ
+                String nearMisses = blank;
+                for (int pos = 0; pos + subLength <= length; pos += subLength) {
+                    nearMisses = replace(nearMisses, pos, nearMiss);
+                }
+                check(nearMisses, sub);
+
+                // Match at the start, in the vector part, in the tail and at
+                // the last possible position
+                for (int pos : new int[] {0, length / 2 - subLength / 2, length - subLength - 1,
+                                          length - subLength}) {
+                    if (pos < 0 || pos + subLength > length) {
+                        continue;
+                    }
+                    check(replace(blank, pos, sub), sub);
+                    check(replace(nearMisses, pos, sub), sub);
+                    check(replace(filler, pos, sub), sub);
+                }
+
+                // Random content, mostly partial matches
+                check(filler, sub);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < WARMUP; i++) {
+            test('a');
+            test('\u0100');
+        }
+    }
+}
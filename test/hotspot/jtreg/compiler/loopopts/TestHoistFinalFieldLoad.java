@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts;
+
+import compiler.lib.ir_framework.*;
+import jdk.internal.misc.Unsafe;
+
+/*
+ * @test
+ * @summary Test hoisting of loop invariant loads from trusted final fields
+ * @requires vm.compiler2.enabled
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.loopopts.TestHoistFinalFieldLoad
+ */
+public class TestHoistFinalFieldLoad {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long HOLDER_X_OFFSET = UNSAFE.objectFieldOffset(Holder.class, "x");
+    private static final int N = 1000;
+
+    // Record fields are always trusted finals
+    record Box(int x) {}
+
+    // Plain final fields are trusted with TrustFinalNonStaticFields
+    static class Holder {
+        final int x;
+        int before;
+        int after;
+
+        Holder(int x) {
+            this.x = x;
+        }
+
+        Holder(int v, int n) {
+            // Reads of x before the store must observe the default value
+            int s = 0;
+            for (int i = 0; i < n; i++) {
+                s += this.x;
+                dontInline();
+            }
+            before = s;
+            this.x = v;
+            int t = 0;
+            for (int i = 0; i < n; i++) {
+                t += this.x;
+                dontInline();
+            }
+            after = t;
+        }
+    }
+
+    static volatile int sinkV;
+    static final Box BOX = new Box(42);
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addFlags("--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED",
+                           "-XX:+UnlockDiagnosticVMOptions",
+                           "-XX:+UnlockExperimentalVMOptions",
+                           "-XX:+TrustFinalNonStaticFields");
+        framework.addScenarios(new Scenario(0, "-XX:+HoistLoopInvariantFinalFieldLoads"),
+                               new Scenario(1, "-XX:-HoistLoopInvariantFinalFieldLoads"));
+        framework.start();
+    }
+
+    @DontInline
+    static void dontInline() {}
+
+    // Positive: the volatile store puts a membar into the loop, which used
+    // to keep the final field load inside the (unrolled) loop body.
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1"},
+        applyIf = {"HoistLoopInvariantFinalFieldLoads", "true"})
+    static void membarInLoop(Box b, int[] a) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b.x();
+            sinkV = i;
+        }
+    }
+
+    @Run(test = "membarInLoop")
+    static void runMembarInLoop() {
+        int[] a = new int[N];
+        membarInLoop(BOX, a);
+        for (int i = 0; i < N; i++) {
+            if (a[i] != 42) {
+                throw new RuntimeException("wrong value at " + i + ": " + a[i]);
+            }
+        }
+    }
+
+    // Positive: a call in the loop cannot change the final field.
+    @Test
+    static int callInLoop(Box b) {
+        int sum = 0;
+        for (int i = 0; i < N; i++) {
+            sum += b.x();
+            dontInline();
+        }
+        return sum;
+    }
+
+    @Run(test = "callInLoop")
+    static void runCallInLoop() {
+        int sum = callInLoop(BOX);
+        if (sum != 42 * N) {
+            throw new RuntimeException("wrong sum: " + sum);
+        }
+    }
+
+    // Negative: a store to the field's slice in the loop must keep the
+    // load in the loop.
+    @Test
+    static int storeInLoop(Holder h) {
+        int sum = 0;
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(h, HOLDER_X_OFFSET, i);
+            sum += h.x;
+        }
+        return sum;
+    }
+
+    @Run(test = "storeInLoop")
+    static void runStoreInLoop() {
+        int sum = storeInLoop(new Holder(0));
+        if (sum != N * (N - 1) / 2) {
+            throw new RuntimeException("wrong sum: " + sum);
+        }
+    }
+
+    // Negative: a receiver allocated in the loop is not loop invariant.
+    @Test
+    static int receiverInLoop() {
+        int sum = 0;
+        for (int i = 0; i < N; i++) {
+            Holder h = new Holder(i);
+            dontInline();
+            sum += h.x;
+        }
+        return sum;
+    }
+
+    @Run(test = "receiverInLoop")
+    static void runReceiverInLoop() {
+        int sum = receiverInLoop();
+        if (sum != N * (N - 1) / 2) {
+            throw new RuntimeException("wrong sum: " + sum);
+        }
+    }
+
+    // Negative: loops in the constructor around the store of the final
+    // field must observe the value current at each loop.
+    @Test
+    static Holder storeInConstructor(int v) {
+        return new Holder(v, N);
+    }
+
+    @Run(test = "storeInConstructor")
+    static void runStoreInConstructor() {
+        Holder h = storeInConstructor(7);
+        if (h.before != 0 || h.after != 7 * N) {
+            throw new RuntimeException("wrong values: " + h.before + " " + h.after);
+        }
+    }
+}
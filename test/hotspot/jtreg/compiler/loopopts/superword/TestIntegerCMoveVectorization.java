@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import java.util.Random;
+
+/*
+ * @test
+ * @summary Test vectorization of int and long CMove selects into VectorBlend
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestIntegerCMoveVectorization
+ */
+public class TestIntegerCMoveVectorization {
+    static final int N = 1024;
+
+    // Boundary values are mixed into otherwise random data. The data stays
+    // unpredictable, so that the diamonds are if-converted into CMoves.
+    static final int[] INT_SPECIAL = {Integer.MIN_VALUE, Integer.MIN_VALUE + 1, -2, -1, 0, 1, 2,
+                                      Integer.MAX_VALUE - 1, Integer.MAX_VALUE};
+    static final long[] LONG_SPECIAL = {Long.MIN_VALUE, Long.MIN_VALUE + 1, -2L, -1L, 0L, 1L, 2L,
+                                        Integer.MIN_VALUE, Integer.MAX_VALUE,
+                                        Long.MAX_VALUE - 1, Long.MAX_VALUE};
+
+    static final int[] aI = new int[N];
+    static final int[] bI = new int[N];
+    static final long[] aL = new long[N];
+    static final long[] bL = new long[N];
+
+    static {
+        Random random = new Random(2024);
+        for (int i = 0; i < N; i++) {
+            aI[i] = random.nextInt(4) == 0 ? INT_SPECIAL[random.nextInt(INT_SPECIAL.length)] : random.nextInt();
+            bI[i] = random.nextInt(4) == 0 ? INT_SPECIAL[random.nextInt(INT_SPECIAL.length)] : random.nextInt();
+            aL[i] = random.nextInt(4) == 0 ? LONG_SPECIAL[random.nextInt(LONG_SPECIAL.length)] : random.nextLong();
+            bL[i] = random.nextInt(4) == 0 ? LONG_SPECIAL[random.nextInt(LONG_SPECIAL.length)] : random.nextLong();
+        }
+        // Equal elements for the >= and == compares
+        for (int i = 0; i < N; i += 7) {
+            bI[i] = aI[i];
+            bL[i] = aL[i];
+        }
+    }
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addScenarios(new Scenario(0, "-XX:+UseVectorCmov"),
+                               new Scenario(1, "-XX:-UseVectorCmov"));
+        framework.start();
+    }
+
+    // ---------------- int ----------------
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_I, "> 0", IRNode.VECTOR_BLEND_I, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"UseVectorCmov", "true"})
+    @IR(failOn = {IRNode.VECTOR_BLEND_I},
+        applyIf = {"UseVectorCmov", "false"})
+    static void selectGTI(int[] a, int[] b, int[] r, int x, int y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] > b[i] ? x : y;
+        }
+    }
+
+    @Run(test = "selectGTI")
+    static void runSelectGTI() {
+        int[] r = new int[N];
+        selectGTI(aI, bI, r, 1, -1);
+        for (int i = 0; i < N; i++) {
+            check("selectGTI", i, r[i], aI[i] > bI[i] ? 1 : -1);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_I, "> 0", IRNode.VECTOR_BLEND_I, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"UseVectorCmov", "true"})
+    static void selectGEI(int[] a, int[] b, int[] r, int x, int y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] >= b[i] ? x : y;
+        }
+    }
+
+    @Run(test = "selectGEI")
+    static void runSelectGEI() {
+        int[] r = new int[N];
+        selectGEI(aI, bI, r, Integer.MAX_VALUE, Integer.MIN_VALUE);
+        for (int i = 0; i < N; i++) {
+            check("selectGEI", i, r[i], aI[i] >= bI[i] ? Integer.MAX_VALUE : Integer.MIN_VALUE);
+        }
+    }
+
+    // Compare against an invariant, including the signed boundaries
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_I, "> 0", IRNode.VECTOR_BLEND_I, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"UseVectorCmov", "true"})
+    static void selectLTInvariantI(int[] a, int[] r, int t, int x, int y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] < t ? x : y;
+        }
+    }
+
+    @Run(test = "selectLTInvariantI")
+    static void runSelectLTInvariantI() {
+        int[] r = new int[N];
+        for (int t : new int[] {0, -1, 1, Integer.MIN_VALUE, Integer.MAX_VALUE}) {
+            selectLTInvariantI(aI, r, t, 3, 4);
+            for (int i = 0; i < N; i++) {
+                check("selectLTInvariantI " + t, i, r[i], aI[i] < t ? 3 : 4);
+            }
+        }
+    }
+
+    // Unsigned compares have no VectorMaskCmp mapping, the CMove packs are
+    // rejected and the loop must still compute the right result.
+    @Test
+    @IR(failOn = {IRNode.VECTOR_BLEND_I})
+    static void selectUnsignedI(int[] a, int[] b, int[] r, int x, int y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = Integer.compareUnsigned(a[i], b[i]) < 0 ? x : y;
+        }
+    }
+
+    @Run(test = "selectUnsignedI")
+    static void runSelectUnsignedI() {
+        int[] r = new int[N];
+        selectUnsignedI(aI, bI, r, 5, 6);
+        for (int i = 0; i < N; i++) {
+            check("selectUnsignedI", i, r[i], Integer.compareUnsigned(aI[i], bI[i]) < 0 ? 5 : 6);
+        }
+    }
+
+    // ---------------- long ----------------
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_L, "> 0", IRNode.VECTOR_BLEND_L, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"UseVectorCmov", "true"})
+    @IR(failOn = {IRNode.VECTOR_BLEND_L},
+        applyIf = {"UseVectorCmov", "false"})
+    static void selectGTL(long[] a, long[] b, long[] r, long x, long y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] > b[i] ? x : y;
+        }
+    }
+
+    @Run(test = "selectGTL")
+    static void runSelectGTL() {
+        long[] r = new long[N];
+        selectGTL(aL, bL, r, Long.MIN_VALUE, Long.MAX_VALUE);
+        for (int i = 0; i < N; i++) {
+            check("selectGTL", i, r[i], aL[i] > bL[i] ? Long.MIN_VALUE : Long.MAX_VALUE);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_L, "> 0", IRNode.VECTOR_BLEND_L, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"UseVectorCmov", "true"})
+    static void selectLEL(long[] a, long[] b, long[] r, long x, long y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] <= b[i] ? x : y;
+        }
+    }
+
+    @Run(test = "selectLEL")
+    static void runSelectLEL() {
+        long[] r = new long[N];
+        selectLEL(aL, bL, r, -1L, 1L);
+        for (int i = 0; i < N; i++) {
+            check("selectLEL", i, r[i], aL[i] <= bL[i] ? -1L : 1L);
+        }
+    }
+
+    // The compare is on longs but the select on ints: the mask lanes do not
+    // line up with the blended values, so there is no VectorBlend.
+    @Test
+    @IR(failOn = {IRNode.VECTOR_BLEND_I})
+    static void selectMixedWidth(long[] a, long[] b, int[] r, int x, int y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = a[i] > b[i] ? x : y;
+        }
+    }
+
+    @Run(test = "selectMixedWidth")
+    static void runSelectMixedWidth() {
+        int[] r = new int[N];
+        selectMixedWidth(aL, bL, r, 7, 8);
+        for (int i = 0; i < N; i++) {
+            check("selectMixedWidth", i, r[i], aL[i] > bL[i] ? 7 : 8);
+        }
+    }
+
+    static void check(String name, int i, long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException(name + ": wrong result at " + i + ": " + actual + ", expected " + expected);
+        }
+    }
+}
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import java.lang.foreign.Arena;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.ValueLayout;
+import java.util.Arrays;
+import java.util.Random;
+import jdk.internal.misc.Unsafe;
+
+/*
+ * @test
+ * @summary Test SuperWord address parsing of long offset arithmetic, as used by
+ *          Unsafe and MemorySegment accesses, including accesses that only alias
+ *          through the long offset
+ * @requires vm.compiler2.enabled
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestLongAddressParsing
+ */
+public class TestLongAddressParsing {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long BASE = Unsafe.ARRAY_INT_BASE_OFFSET;
+    private static final ValueLayout.OfInt INT = ValueLayout.JAVA_INT_UNALIGNED;
+
+    static final int N = 1000;
+    // Accesses stay within [0, PAD) ints past the loop range
+    static final int PAD = 32;
+    // Byte distances between the load and the store of the aliasing tests,
+    // relative to a base offset of PAD / 2 ints
+    static final long[] DELTAS = {-64, -12, -8, -4, -2, 0, 2, 4, 8, 12, 64};
+
+    static final Random RANDOM = new Random(7);
+    static final int[] INPUT = new int[N + PAD];
+    static {
+        for (int i = 0; i < INPUT.length; i++) {
+            INPUT[i] = RANDOM.nextInt();
+        }
+    }
+
+    static final MemorySegment NATIVE = Arena.ofAuto().allocate(4L * (N + PAD), 8);
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addFlags("--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED");
+        framework.addScenarios(new Scenario(0),
+                               new Scenario(1, "-XX:-UseSuperWord"),
+                               new Scenario(2, "-XX:+UnlockDiagnosticVMOptions", "-XX:+StressIGVN"));
+        framework.start();
+    }
+
+    // ---------------- Unsafe on int[] with long offsets ----------------
+
+    // AddL(LShiftL(ConvI2L(i), 2), ConL)
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.ADD_VI, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"UseSuperWord", "true"})
+    static void unsafeConstOffset(int[] a) {
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(a, BASE + 4L * i + 8, UNSAFE.getInt(a, BASE + 4L * i + 8) + 1);
+        }
+    }
+
+    @DontCompile
+    static void unsafeConstOffsetReference(int[] a) {
+        for (int i = 0; i < N; i++) {
+            a[i + 2] = a[i + 2] + 1;
+        }
+    }
+
+    @Run(test = "unsafeConstOffset")
+    static void runUnsafeConstOffset() {
+        int[] a = INPUT.clone();
+        int[] b = INPUT.clone();
+        unsafeConstOffset(a);
+        unsafeConstOffsetReference(b);
+        verify("unsafeConstOffset", a, b);
+    }
+
+    // AddL(LShiftL(ConvI2L(i), 2), invariant)
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.MUL_VI, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"UseSuperWord", "true"})
+    static void unsafeInvariantOffset(int[] a, long offset) {
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(a, BASE + 4L * i + offset, UNSAFE.getInt(a, BASE + 4L * i + offset) * 3);
+        }
+    }
+
+    @DontCompile
+    static void unsafeInvariantOffsetReference(int[] a, long offset) {
+        for (int i = 0; i < N; i++) {
+            int j = i + (int)(offset / 4);
+            a[j] = a[j] * 3;
+        }
+    }
+
+    @Run(test = "unsafeInvariantOffset")
+    static void runUnsafeInvariantOffset() {
+        for (long offset : new long[] {0, 4, 12, 64}) {
+            int[] a = INPUT.clone();
+            int[] b = INPUT.clone();
+            unsafeInvariantOffset(a, offset);
+            unsafeInvariantOffsetReference(b, offset);
+            verify("unsafeInvariantOffset " + offset, a, b);
+        }
+    }
+
+    // The store goes one element ahead of the load, which is only visible
+    // through the long constant. This is a loop carried dependence with a
+    // distance of one element, so the loop must not be vectorized.
+    @Test
+    @IR(counts = {IRNode.STORE_VECTOR, "= 0"},
+        applyIf = {"UseSuperWord", "true"})
+    static void unsafeConstAlias(int[] a) {
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(a, BASE + 4L * i + 4, UNSAFE.getInt(a, BASE + 4L * i) + 1);
+        }
+    }
+
+    @DontCompile
+    static void unsafeConstAliasReference(int[] a) {
+        for (int i = 0; i < N; i++) {
+            a[i + 1] = a[i] + 1;
+        }
+    }
+
+    @Run(test = "unsafeConstAlias")
+    static void runUnsafeConstAlias() {
+        int[] a = INPUT.clone();
+        int[] b = INPUT.clone();
+        unsafeConstAlias(a);
+        unsafeConstAliasReference(b);
+        verify("unsafeConstAlias", a, b);
+    }
+
+    // Load and store only differ in their long invariant offsets, so whether
+    // they alias is only known at runtime.
+    @Test
+    static void unsafeInvariantAlias(int[] a, long from, long to) {
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(a, BASE + 4L * i + to, UNSAFE.getInt(a, BASE + 4L * i + from) + 1);
+        }
+    }
+
+    @DontCompile
+    static void unsafeInvariantAliasReference(int[] a, long from, long to) {
+        for (int i = 0; i < N; i++) {
+            UNSAFE.putInt(a, BASE + 4L * i + to, UNSAFE.getInt(a, BASE + 4L * i + from) + 1);
+        }
+    }
+
+    @Run(test = "unsafeInvariantAlias")
+    static void runUnsafeInvariantAlias() {
+        for (long delta : DELTAS) {
+            long from = 4L * (PAD / 2);
+            long to = from + delta;
+            int[] a = INPUT.clone();
+            int[] b = INPUT.clone();
+            unsafeInvariantAlias(a, from, to);
+            unsafeInvariantAliasReference(b, from, to);
+            verify("unsafeInvariantAlias " + delta, a, b);
+        }
+    }
+
+    // ---------------- MemorySegment with long offsets ----------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.ADD_VI, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"UseSuperWord", "true"})
+    static void segmentConstOffset(MemorySegment m) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + 8, m.get(INT, 4L * i + 8) + 1);
+        }
+    }
+
+    @DontCompile
+    static void segmentConstOffsetReference(MemorySegment m) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + 8, m.get(INT, 4L * i + 8) + 1);
+        }
+    }
+
+    // Only native segments, so that the IR rule does not depend on the
+    // profile of the segment type.
+    @Run(test = "segmentConstOffset")
+    static void runSegmentConstOffset() {
+        MemorySegment m = segments()[1];
+        MemorySegment expected = copy(m);
+        segmentConstOffset(m);
+        segmentConstOffsetReference(expected);
+        verify("segmentConstOffset", m, expected);
+    }
+
+    @Test
+    static void segmentConstAlias(MemorySegment m) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + 4, m.get(INT, 4L * i) + 1);
+        }
+    }
+
+    @DontCompile
+    static void segmentConstAliasReference(MemorySegment m) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + 4, m.get(INT, 4L * i) + 1);
+        }
+    }
+
+    @Run(test = "segmentConstAlias")
+    static void runSegmentConstAlias() {
+        for (MemorySegment m : segments()) {
+            MemorySegment expected = copy(m);
+            segmentConstAlias(m);
+            segmentConstAliasReference(expected);
+            verify("segmentConstAlias", m, expected);
+        }
+    }
+
+    // Includes distances that are not a multiple of the element size, where
+    // the load and the store partially overlap.
+    @Test
+    static void segmentInvariantAlias(MemorySegment m, long from, long to) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + to, m.get(INT, 4L * i + from) + 1);
+        }
+    }
+
+    @DontCompile
+    static void segmentInvariantAliasReference(MemorySegment m, long from, long to) {
+        for (int i = 0; i < N; i++) {
+            m.set(INT, 4L * i + to, m.get(INT, 4L * i + from) + 1);
+        }
+    }
+
+    @Run(test = "segmentInvariantAlias")
+    static void runSegmentInvariantAlias() {
+        for (MemorySegment m : segments()) {
+            for (long delta : DELTAS) {
+                long from = 4L * (PAD / 2);
+                long to = from + delta;
+                MemorySegment expected = copy(m);
+                segmentInvariantAlias(m, from, to);
+                segmentInvariantAliasReference(expected, from, to);
+                verify("segmentInvariantAlias " + delta, m, expected);
+            }
+        }
+    }
+
+    // ---------------- Helpers ----------------
+
+    // A heap segment and a native one, both filled with INPUT.
+    static MemorySegment[] segments() {
+        MemorySegment heap = MemorySegment.ofArray(INPUT.clone());
+        MemorySegment.copy(MemorySegment.ofArray(INPUT), 0, NATIVE, 0, NATIVE.byteSize());
+        return new MemorySegment[] {heap, NATIVE};
+    }
+
+    static MemorySegment copy(MemorySegment m) {
+        return MemorySegment.ofArray(m.toArray(ValueLayout.JAVA_INT));
+    }
+
+    static void verify(String name, int[] actual, int[] expected) {
+        if (!Arrays.equals(actual, expected)) {
+            throw new RuntimeException(name + ": wrong result at index " + Arrays.mismatch(actual, expected));
+        }
+    }
+
+    static void verify(String name, MemorySegment actual, MemorySegment expected) {
+        long mismatch = actual.mismatch(expected);
+        if (mismatch != -1) {
+            throw new RuntimeException(name + ": wrong result at byte offset " + mismatch);
+        }
+    }
+}
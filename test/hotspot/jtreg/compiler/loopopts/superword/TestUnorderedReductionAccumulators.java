@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import java.util.Random;
+
+/*
+ * @test
+ * @summary Test that unordered reductions moved out of the loop give the same
+ *          result when split over several vector accumulators
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestUnorderedReductionAccumulators
+ */
+public class TestUnorderedReductionAccumulators {
+    static final int RANGE = 1024;
+    static final int REPETITIONS = 100;
+
+    static final int[] aI = new int[RANGE];
+    static final long[] aL = new long[RANGE];
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addFlags("-XX:+UnlockDiagnosticVMOptions");
+        framework.addScenarios(new Scenario(0, "-XX:SuperWordReductionAccumulators=1"),
+                               new Scenario(1, "-XX:SuperWordReductionAccumulators=2"),
+                               new Scenario(2, "-XX:SuperWordReductionAccumulators=4"),
+                               new Scenario(3, "-XX:SuperWordReductionAccumulators=8"),
+                               new Scenario(4, "-XX:SuperWordReductionAccumulators=3",
+                                               "-XX:LoopMaxUnroll=8"));
+        framework.start();
+    }
+
+    static {
+        Random random = new Random(42);
+        for (int i = 0; i < RANGE; i++) {
+            aI[i] = random.nextInt();
+            aL[i] = random.nextLong();
+        }
+    }
+
+    // The vector accumulators stay in the loop, only the post-loop reduction
+    // remains. With more than one accumulator, the chains are combined with
+    // additional vector ops after the loop, in front of that reduction.
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0",
+                  IRNode.ADD_VI, "> 0",
+                  IRNode.ADD_REDUCTION_VI, "> 0"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    @IR(counts = {IRNode.ADD_VI, "> 1"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIfAnd = {"SuperWordReductions", "true", "SuperWordReductionAccumulators", "> 1"})
+    static int addI(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] * 3;
+        }
+        return sum;
+    }
+
+    @DontCompile
+    static int addIReference(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] * 3;
+        }
+        return sum;
+    }
+
+    @Run(test = "addI")
+    static void runAddI() {
+        int expected = addIReference(aI);
+        for (int j = 0; j < REPETITIONS; j++) {
+            int result = addI(aI);
+            if (result != expected) {
+                throw new RuntimeException("addI: wrong result " + result + ", expected " + expected);
+            }
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_L, "> 0",
+                  IRNode.ADD_VL, "> 0",
+                  IRNode.ADD_REDUCTION_VL, "> 0"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static long addL(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @DontCompile
+    static long addLReference(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "addL")
+    static void runAddL() {
+        long expected = addLReference(aL);
+        for (int j = 0; j < REPETITIONS; j++) {
+            long result = addL(aL);
+            if (result != expected) {
+                throw new RuntimeException("addL: wrong result " + result + ", expected " + expected);
+            }
+        }
+    }
+
+    // Min is not invertible, any accumulator that is lost or counted twice
+    // shows up in the result.
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0",
+                  IRNode.MIN_VI, "> 0",
+                  IRNode.MIN_REDUCTION_V, "> 0"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static int minI(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+        }
+        return min;
+    }
+
+    @DontCompile
+    static int minIReference(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+        }
+        return min;
+    }
+
+    @Run(test = "minI")
+    static void runMinI() {
+        // Move the minimum around, so that every accumulator has to carry it once.
+        int[] a = aI.clone();
+        for (int j = 0; j < REPETITIONS; j++) {
+            int pos = (j * 7) % RANGE;
+            int saved = a[pos];
+            a[pos] = Integer.MIN_VALUE + j;
+            int expected = minIReference(a);
+            int result = minI(a);
+            if (result != expected) {
+                throw new RuntimeException("minI: wrong result " + result + ", expected " + expected);
+            }
+            a[pos] = saved;
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test TestSoftMaxHeapSizeFollowsMemoryLimit
+ * @summary An explicit heap size disables SoftMaxHeapSizeFollowsMemoryLimit
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver gc.TestSoftMaxHeapSizeFollowsMemoryLimit
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSoftMaxHeapSizeFollowsMemoryLimit {
+    private static final String MESSAGE = "SoftMaxHeapSize does not follow the memory limit";
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        String[] common = new String[] {
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+SoftMaxHeapSizeFollowsMemoryLimit",
+            "-Xlog:gc+ergo=info",
+        };
+        String[] args = new String[common.length + flags.length + 1];
+        System.arraycopy(common, 0, args, 0, common.length);
+        System.arraycopy(flags, 0, args, common.length, flags.length);
+        args[args.length - 1] = "-version";
+        OutputAnalyzer output = ProcessTools.executeTestJava(args);
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Without an explicit heap size SoftMaxHeapSize follows the limit
+        run().shouldNotContain(MESSAGE);
+
+        // An explicit -Xmx takes precedence over the memory limit
+        run("-Xmx128m")
+            .shouldContain(MESSAGE + ": MaxHeapSize set on the command line");
+        run("-XX:MaxHeapSize=128m")
+            .shouldContain(MESSAGE + ": MaxHeapSize set on the command line");
+
+        // As does an explicit SoftMaxHeapSize
+        run("-Xmx256m", "-XX:SoftMaxHeapSize=128m")
+            .shouldContain(MESSAGE + ": MaxHeapSize set on the command line");
+        run("-XX:SoftMaxHeapSize=64m")
+            .shouldContain(MESSAGE + ": SoftMaxHeapSize set on the command line");
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestStallRiskLimit
+ * @requires vm.gc.ZGenerational
+ * @summary Test the ZGC allocation burst rule driven by ZStallRiskLimit
+ * @library /test/lib
+ * @run driver gc.z.TestStallRiskLimit
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStallRiskLimit {
+    private static final String RULE = "Rule Minor: Allocation Burst";
+    private static final String RISK = "Allocation Stall Risk";
+
+    static class Test {
+        private static volatile Object sink;
+
+        public static void main(String[] args) {
+            // Allocate in bursts to give the director a varying allocation rate
+            final long end = System.currentTimeMillis() + 3000;
+            while (System.currentTimeMillis() < end) {
+                for (int i = 0; i < 10_000; i++) {
+                    sink = new byte[1024];
+                }
+                try {
+                    Thread.sleep(10);
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        }
+    }
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        String[] common = new String[] {
+            "-XX:+UseZGC",
+            "-XX:+ZGenerational",
+            "-Xmx128M",
+        };
+        String[] args = new String[common.length + flags.length + 1];
+        System.arraycopy(common, 0, args, 0, common.length);
+        System.arraycopy(flags, 0, args, common.length, flags.length);
+        args[args.length - 1] = Test.class.getName();
+        OutputAnalyzer output = ProcessTools.executeTestJava(args);
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The rule is disabled by default, and the stall risk is not part
+        // of the default gc logging
+        run("-Xlog:gc*=info")
+            .shouldNotContain(RULE)
+            .shouldNotContain(RISK);
+
+        // With a limit below 1.0 the VM runs with the rule enabled, and the
+        // stall risk is logged at debug level
+        run("-XX:+UnlockExperimentalVMOptions", "-XX:ZStallRiskLimit=0.01",
+            "-Xlog:gc+alloc=debug")
+            .shouldContain(RISK);
+    }
+}
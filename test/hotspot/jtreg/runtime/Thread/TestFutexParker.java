@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Stress park/unpark, monitors and sleep with the futex based
+ *          Parker and PlatformEvent
+ * @requires os.family == "linux"
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseFutexParker TestFutexParker
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseFutexParker -Xint TestFutexParker
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.locks.LockSupport;
+import java.util.concurrent.locks.ReentrantLock;
+
+public class TestFutexParker {
+    static final int ITERATIONS = 100_000;
+
+    static volatile int turn;
+
+    // LockSupport.park/unpark ping-pong: every wakeup is needed to make progress,
+    // so a lost unpark hangs the test.
+    static void parkPingPong() throws Exception {
+        turn = 0;
+        Thread[] threads = new Thread[2];
+        for (int t = 0; t < 2; t++) {
+            final int me = t;
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < ITERATIONS; i++) {
+                    while (turn != me) {
+                        LockSupport.park();
+                    }
+                    turn = 1 - me;
+                    LockSupport.unpark(threads[1 - me]);
+                }
+            });
+        }
+        for (Thread t : threads) {
+            t.start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+
+    // Object.wait/notify ping-pong, blocking on the monitor's ParkEvents.
+    static void monitorPingPong() throws Exception {
+        final Object lock = new Object();
+        turn = 0;
+        Thread[] threads = new Thread[2];
+        for (int t = 0; t < 2; t++) {
+            final int me = t;
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < ITERATIONS / 10; i++) {
+                    synchronized (lock) {
+                        while (turn != me) {
+                            try {
+                                lock.wait();
+                            } catch (InterruptedException e) {
+                                throw new RuntimeException(e);
+                            }
+                        }
+                        turn = 1 - me;
+                        lock.notify();
+                    }
+                }
+            });
+        }
+        for (Thread t : threads) {
+            t.start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+
+    // Contended monitors and j.u.c locks, mixing both kinds of parking.
+    static void contention() throws Exception {
+        final Object monitor = new Object();
+        final ReentrantLock lock = new ReentrantLock();
+        final int nThreads = Math.max(4, Runtime.getRuntime().availableProcessors() * 2);
+        final int perThread = ITERATIONS / 10;
+        final long[] counters = new long[2];
+        Thread[] threads = new Thread[nThreads];
+        for (int t = 0; t < nThreads; t++) {
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < perThread; i++) {
+                    synchronized (monitor) {
+                        counters[0]++;
+                    }
+                    lock.lock();
+                    try {
+                        counters[1]++;
+                    } finally {
+                        lock.unlock();
+                    }
+                }
+            });
+        }
+        for (Thread t : threads) {
+            t.start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        long expected = (long)nThreads * perThread;
+        if (counters[0] != expected || counters[1] != expected) {
+            throw new RuntimeException("Lost updates: " + counters[0] + ", " + counters[1] +
+                                       ", expected " + expected);
+        }
+    }
+
+    // Timed waits must not return early unless woken.
+    static void timeouts() throws Exception {
+        final long nanos = TimeUnit.MILLISECONDS.toNanos(20);
+        for (int i = 0; i < 10; i++) {
+            // park may return spuriously, sleep and wait may not
+            LockSupport.parkNanos(nanos);
+            long start = System.nanoTime();
+            Thread.sleep(20);
+            check(System.nanoTime() - start >= nanos, "Thread.sleep returned early");
+            Object o = new Object();
+            start = System.nanoTime();
+            synchronized (o) {
+                long remaining = nanos;
+                while (remaining > 0) {
+                    TimeUnit.NANOSECONDS.timedWait(o, remaining);
+                    remaining = nanos - (System.nanoTime() - start);
+                }
+            }
+            LockSupport.parkUntil(System.currentTimeMillis() + 20);
+        }
+    }
+
+    // An interrupt unparks both kinds of waits.
+    static void interrupts() throws Exception {
+        for (int i = 0; i < 100; i++) {
+            CountDownLatch started = new CountDownLatch(1);
+            AtomicInteger done = new AtomicInteger();
+            Thread parker = new Thread(() -> {
+                started.countDown();
+                while (!Thread.interrupted()) {
+                    LockSupport.park();
+                }
+                try {
+                    Thread.sleep(TimeUnit.MINUTES.toMillis(10));
+                } catch (InterruptedException e) {
+                    done.incrementAndGet();
+                }
+            });
+            parker.start();
+            started.await();
+            parker.interrupt();
+            while (done.get() == 0 && parker.isAlive()) {
+                parker.interrupt();
+                Thread.sleep(1);
+            }
+            parker.join();
+            check(done.get() == 1, "sleep was not interrupted");
+        }
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        parkPingPong();
+        monitorPingPong();
+        contention();
+        timeouts();
+        interrupts();
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that UseMadvCollapse is consistent with the MADV_COLLAPSE probe
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run driver TestMadvCollapse
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMadvCollapse {
+    private static final String WARNING =
+        "MADV_COLLAPSE is not supported by the kernel, disabling UseMadvCollapse";
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseMadvCollapse",
+            "-XX:+UseTransparentHugePages",
+            "-XX:+AlwaysPreTouch",
+            "-Xmx64m",
+            "-XX:+PrintFlagsFinal",
+            "-version");
+        output.shouldHaveExitValue(0);
+
+        // The probe runs after argument parsing and turns the flag off if the
+        // kernel rejects MADV_COLLAPSE; otherwise the flag must stay enabled.
+        if (output.getOutput().contains(WARNING)) {
+            output.shouldMatch("bool UseMadvCollapse\\s+= false\\s+\\{experimental\\} \\{ergonomic\\}");
+        } else {
+            output.shouldMatch("bool UseMadvCollapse\\s+= true\\s+\\{experimental\\} \\{command line\\}");
+        }
+    }
+}
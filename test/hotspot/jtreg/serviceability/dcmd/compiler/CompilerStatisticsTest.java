@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.statistics
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ * @run testng/othervm -XX:CompilationRecordCount=256 CompilerStatisticsTest
+ */
+public class CompilerStatisticsTest {
+    static int sink;
+
+    static int work(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += i * 31 ^ (sum >>> 3);
+        }
+        return sum;
+    }
+
+    public void run(CommandExecutor executor) {
+        // Make sure there is something to compile
+        for (int i = 0; i < 20_000; i++) {
+            sink += work(100);
+        }
+
+        OutputAnalyzer output = executor.execute("Compiler.statistics");
+        output.shouldMatch("\\d+ of the last \\d+ compilations, by CPU time:");
+        output.shouldContain("cpu ms  wall ms     id lvl   bci  bytes inlined  nm size  method");
+
+        output = executor.execute("Compiler.statistics 1");
+        output.shouldMatch("1 of the last \\d+ compilations, by CPU time:");
+
+        output = executor.execute("Compiler.statistics -1");
+        output.shouldContain("Invalid limit: -1");
+        output.shouldNotContain("compilations, by CPU time");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+}
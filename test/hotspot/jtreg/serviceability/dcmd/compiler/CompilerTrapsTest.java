@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.traps
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ * @run testng/othervm -XX:-BackgroundCompilation -XX:-TieredCompilation CompilerTrapsTest
+ */
+public class CompilerTrapsTest {
+    static int sink;
+
+    // Compiled with an uncommon trap for the never seen non-Integer case
+    static int trap(Object o) {
+        if (o instanceof Integer i) {
+            return i;
+        }
+        return o.hashCode();
+    }
+
+    public void run(CommandExecutor executor) {
+        for (int i = 0; i < 100_000; i++) {
+            sink += trap(i);
+        }
+        sink += trap("not an Integer");
+
+        OutputAnalyzer output = executor.execute("Compiler.traps");
+        output.shouldMatch("\\d+ +CompilerTrapsTest::trap \\(decompiles: \\d+, recompiles after overflow: \\d+\\)");
+
+        output = executor.execute("Compiler.traps 0");
+        output.shouldNotContain("CompilerTrapsTest::trap");
+
+        output = executor.execute("Compiler.traps -1");
+        output.shouldContain("Invalid limit: -1");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+}
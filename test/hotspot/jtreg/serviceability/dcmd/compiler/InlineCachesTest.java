@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.inlinecaches
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ * @run testng/othervm -XX:-BackgroundCompilation -XX:-TieredCompilation
+ *                     -XX:CompileCommand=dontinline,InlineCachesTest::call
+ *                     InlineCachesTest
+ */
+public class InlineCachesTest {
+    interface Shape { int area(); }
+    static class A implements Shape { public int area() { return 1; } }
+    static class B implements Shape { public int area() { return 2; } }
+    static class C implements Shape { public int area() { return 3; } }
+    static class D implements Shape { public int area() { return 4; } }
+
+    static int sink;
+
+    // A megamorphic call site, compiled as a virtual call through an
+    // inline cache that misses once it sees a second receiver class
+    static int call(Shape s) {
+        return s.area();
+    }
+
+    public void run(CommandExecutor executor) {
+        Shape[] shapes = { new A(), new B(), new C(), new D() };
+        for (int i = 0; i < 200_000; i++) {
+            sink += call(shapes[i & 3]);
+        }
+
+        OutputAnalyzer output = executor.execute("Compiler.inlinecaches");
+        output.shouldMatch("\\d+ (megamorphic|monomorphic|clean      ) \\d+ +InlineCachesTest::call @ \\d+");
+
+        output = executor.execute("Compiler.inlinecaches 0");
+        output.shouldNotContain("InlineCachesTest::call");
+
+        output = executor.execute("Compiler.inlinecaches -1");
+        output.shouldContain("Invalid limit: -1");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+}
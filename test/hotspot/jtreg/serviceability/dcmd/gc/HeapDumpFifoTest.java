@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.concurrent.atomic.AtomicReference;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.heap_dump into a FIFO
+ * @requires os.family != "windows"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng HeapDumpFifoTest
+ */
+public class HeapDumpFifoTest {
+    private static final String NO_READER = "No reader attached to the FIFO";
+
+    public void run(CommandExecutor executor) throws Exception {
+        File fifo = new File("heapdump-" + ProcessHandle.current().pid() + ".fifo");
+        File copy = new File("heapdump-" + ProcessHandle.current().pid() + ".hprof");
+        fifo.delete();
+        copy.delete();
+        ProcessTools.executeCommand("mkfifo", fifo.getAbsolutePath()).shouldHaveExitValue(0);
+
+        try {
+            // Without a reader the dump fails right away instead of blocking
+            // in VM state.
+            OutputAnalyzer output = executor.execute("GC.heap_dump " + fifo.getAbsolutePath());
+            output.shouldContain(NO_READER);
+
+            // A reader copies the stream to a regular file for parsing.
+            AtomicReference<Exception> failure = new AtomicReference<>();
+            Thread reader = new Thread(() -> {
+                try (InputStream in = new FileInputStream(fifo);
+                     OutputStream out = new FileOutputStream(copy)) {
+                    in.transferTo(out);
+                } catch (Exception e) {
+                    failure.set(e);
+                }
+            }, "HeapDumpFifoTest-Reader");
+            reader.start();
+
+            // The reader has to be waiting in open() before the dump can start.
+            do {
+                Thread.sleep(100);
+                output = executor.execute("GC.heap_dump " + fifo.getAbsolutePath());
+            } while (output.getOutput().contains(NO_READER));
+            output.shouldContain("Heap dump file created");
+
+            reader.join();
+            if (failure.get() != null) {
+                throw failure.get();
+            }
+
+            // The dump was written directly, without segment files next to the FIFO.
+            if (new File(fifo.getAbsolutePath() + ".p0").exists()) {
+                throw new RuntimeException("Segment file left behind for " + fifo);
+            }
+
+            HprofParser.parse(copy);
+        } finally {
+            fifo.delete();
+            copy.delete();
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
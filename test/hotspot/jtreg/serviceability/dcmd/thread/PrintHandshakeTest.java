@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import java.util.concurrent.CountDownLatch;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Thread.print -handshake
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng PrintHandshakeTest
+ */
+public class PrintHandshakeTest {
+    private static final String THREAD_NAME = "PrintHandshakeTest-Sleeper";
+
+    private static void sleeperMethod(CountDownLatch started) {
+        started.countDown();
+        try {
+            Thread.sleep(Long.MAX_VALUE);
+        } catch (InterruptedException e) {
+            // Done
+        }
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        CountDownLatch started = new CountDownLatch(1);
+        Thread sleeper = new Thread(() -> sleeperMethod(started), THREAD_NAME);
+        sleeper.setDaemon(true);
+        sleeper.start();
+        started.await();
+        try {
+            OutputAnalyzer output = executor.execute("Thread.print -handshake");
+            output.shouldContain("Full thread dump");
+            output.shouldContain("Threads class SMR info:");
+            output.shouldContain("\"" + THREAD_NAME + "\"");
+            output.shouldContain("java.lang.Thread.State: TIMED_WAITING (sleeping)");
+            output.shouldContain("PrintHandshakeTest.sleeperMethod");
+            // The JNI handle summary needs a safepoint and is left out
+            output.shouldNotContain("JNI global refs");
+
+            output = executor.execute("Thread.print -e -handshake");
+            output.shouldContain("\"" + THREAD_NAME + "\"");
+            output.shouldContain("PrintHandshakeTest.sleeperMethod");
+
+            // The j.u.c lock scan needs a safepoint
+            output = executor.execute("Thread.print -l -handshake");
+            output.shouldContain("-l requires a safepoint and cannot be used with -handshake");
+            output.shouldNotContain("Full thread dump");
+        } finally {
+            sleeper.interrupt();
+            sleeper.join();
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}